@@ -27,39 +27,28 @@
 
 
 int main(void){
-    gpio_config_t pa5_Tim = {
-        .pin  = PIN('A', 5),
-        .mode = GPIO_MODE_ALTFUNC,
-        .otype= GPIO_OTYPE_PUSHPULL,
-        .speed= GPIO_SPEED_HIGH,
-        .pull = GPIO_NO_PULL
+    rcc_clock_config_t clk = {
+        .source    = RCC_SRC_HSI,
+        .sysclk_hz = 180000000,          // HCLK 180 MHz, APB1 45 MHz, APB2 90 MHz
     };
+    rcc_clock_config(&clk);
+    hal_tick_init();
 
-    gpio_config_t uart_cfg ={   //pa2 is uart2_tx 
-        .pin = PIN('A', 2),
-        .mode = GPIO_MODE_ALTFUNC,
-        .otype = GPIO_OTYPE_PUSHPULL,
-        .speed = GPIO_SPEED_HIGH,
-        .pull = GPIO_NO_PULL
+    static const gpio_config_t board_pins[] = {
+        { PIN('A', 2), GPIO_MODE_ALTFUNC, GPIO_OTYPE_PUSHPULL, GPIO_SPEED_HIGH, GPIO_NO_PULL, 7 },  // USART2_TX
+        { PIN('A', 5), GPIO_MODE_ALTFUNC, GPIO_OTYPE_PUSHPULL, GPIO_SPEED_HIGH, GPIO_NO_PULL, 1 },  // TIM2_CH1
     };
 
+    static const volatile void *const board_clocks[] = { USART2, TIM2 };
 
+    gpio_init_table(board_pins, sizeof(board_pins) / sizeof(board_pins[0]));
+    rcc_enable_many(board_clocks, sizeof(board_clocks) / sizeof(board_clocks[0]));
 
-    rcc_enable_gpio(GET_PORT(pa5_Tim.pin));
-    rcc_enable_uart(USART2);
-    rcc_enable_tim(TIM2);
-
-
-    gpio_init(uart_cfg);
-    gpio_init(pa5_Tim);
-    gpio_set_af(pa5_Tim.pin, 1);
-    gpio_set_af(uart_cfg.pin, 7);
-
-    tim_pwm_init(TIM2, 16000, 1000);
-    tim_pwm_config_channel(TIM2, 1, 500);
+    tim_pwm_init(TIM2, 10000, 10000);   // 10 kHz tick, 1 Hz period
+    tim_pwm_config_channel(TIM2, 1, 5000);
     tim_pwm_start(TIM2);
 
-    uart_init(USART2, 16000000, UART_BAUD_115200);
+    uart_init(USART2, UART_BAUD_115200);
     uart_print(USART2, "UART INITIALIZED!\r\n");
 
     while(1){
@@ -0,0 +1,341 @@
+/**
+ * @file hal.hpp
+ * @brief Header-only C++ layer over the STM32F446RE registers.
+ *
+ * Port, pin and peripheral base addresses are template parameters, so every
+ * register address is a compile-time constant: `Pin<Port::A, 5>::set()` is a
+ * single store to GPIOA->BSRR, with no pin decoding, port table lookup or
+ * branch. Pins that are not bonded out on the STM32F446RE (LQFP64) and pin /
+ * alternate-function combinations that don't exist are rejected by
+ * `static_assert` at compile time.
+ *
+ * Everything is `static` and force-inlined, so it costs nothing at `-O0` and
+ * can be mixed freely with the C API (the C headers are `extern "C"`-safe).
+ *
+ * @code
+ * using Led   = hal::Pin<hal::Port::A, 5>;
+ * using Tx    = hal::Pin<hal::Port::A, 2>;
+ * using Rx    = hal::Pin<hal::Port::A, 3>;
+ * using Debug = hal::Uart<USART2_BASE>;
+ * using Tick  = hal::Timer<TIM2_BASE>;
+ *
+ * Led::clock_enable();
+ * Led::output();
+ * Debug::pins<Tx, Rx>();               // AF7 looked up and checked at compile time
+ * Debug::init(rcc_get_pclk(USART2), 115200);
+ *
+ * Led::set();                          // str r2, [r3, #24]
+ * Debug::put('A');
+ * @endcode
+ */
+
+#ifndef HAL_HPP
+#define HAL_HPP
+
+#include <stdint.h>
+#include "stm32f4_gpio.h"
+#include "stm32f4_uart.h"
+#include "stm32f4_tim.h"
+#include "stm32f4_spi.h"
+#include "stm32f4_rcc.h"
+
+/// Forces inlining even at `-O0`, so each accessor is only its register access.
+#define HAL_INLINE __attribute__((always_inline)) static inline
+
+namespace hal {
+
+/**
+ * @brief GPIO port letter.
+ */
+enum class Port : uint8_t { A, B, C, D, E, F, G, H };
+
+namespace detail {
+
+/**
+ * @brief Base address of a GPIO port (ports are 0x400 apart on AHB1).
+ */
+constexpr uintptr_t gpio_base(Port p) {
+    return GPIOA_BASE + 0x400U * static_cast<uint32_t>(p);
+}
+
+/**
+ * @brief Whether a pin is bonded out on the STM32F446RE LQFP64 package.
+ *
+ * PA/PC: all 16. PB: all but PB11 (VCAP1 on this package). PD: PD2 only.
+ * PH: PH0/PH1 (oscillator pins). PE/PF/PG: not available.
+ */
+constexpr bool pin_exists(Port p, uint8_t n) {
+    return (n < 16) &&
+           ((p == Port::A) || (p == Port::C) ||
+            (p == Port::B && n != 11) ||
+            (p == Port::D && n == 2) ||
+            (p == Port::H && n <= 1));
+}
+
+/**
+ * @brief One row of the alternate-function map (DS10693, table 11).
+ */
+struct AfEntry {
+    uintptr_t periph;   ///< Peripheral base address
+    Port port;          ///< Pin port
+    uint8_t pin;        ///< Pin number
+    uint8_t af;         ///< AF number selecting `periph` on that pin
+};
+
+/**
+ * @brief Alternate-function map for the peripherals driven by this HAL.
+ *
+ * Covers the signals of TIM1–4, USART1–3/6, UART4/5 and SPI1–3 on pins of the
+ * LQFP64 package. Add rows here to enable more combinations.
+ */
+constexpr AfEntry af_table[] = {
+    // TIM1 (AF1)
+    { TIM1_BASE, Port::A, 8, 1 },  { TIM1_BASE, Port::A, 9, 1 },  { TIM1_BASE, Port::A, 10, 1 },
+    { TIM1_BASE, Port::A, 11, 1 }, { TIM1_BASE, Port::A, 7, 1 },  { TIM1_BASE, Port::B, 13, 1 },
+    { TIM1_BASE, Port::B, 14, 1 }, { TIM1_BASE, Port::B, 15, 1 }, { TIM1_BASE, Port::B, 0, 1 },
+    { TIM1_BASE, Port::B, 1, 1 },  { TIM1_BASE, Port::A, 6, 1 },  { TIM1_BASE, Port::B, 12, 1 },
+    // TIM2 (AF1)
+    { TIM2_BASE, Port::A, 0, 1 },  { TIM2_BASE, Port::A, 1, 1 },  { TIM2_BASE, Port::A, 2, 1 },
+    { TIM2_BASE, Port::A, 3, 1 },  { TIM2_BASE, Port::A, 5, 1 },  { TIM2_BASE, Port::A, 15, 1 },
+    { TIM2_BASE, Port::B, 3, 1 },  { TIM2_BASE, Port::B, 10, 1 },
+    // TIM3 (AF2)
+    { TIM3_BASE, Port::A, 6, 2 },  { TIM3_BASE, Port::A, 7, 2 },  { TIM3_BASE, Port::B, 0, 2 },
+    { TIM3_BASE, Port::B, 1, 2 },  { TIM3_BASE, Port::B, 4, 2 },  { TIM3_BASE, Port::B, 5, 2 },
+    { TIM3_BASE, Port::C, 6, 2 },  { TIM3_BASE, Port::C, 7, 2 },  { TIM3_BASE, Port::C, 8, 2 },
+    { TIM3_BASE, Port::C, 9, 2 },  { TIM3_BASE, Port::D, 2, 2 },
+    // TIM4 (AF2)
+    { TIM4_BASE, Port::B, 6, 2 },  { TIM4_BASE, Port::B, 7, 2 },  { TIM4_BASE, Port::B, 8, 2 },
+    { TIM4_BASE, Port::B, 9, 2 },
+    // USART1/2/3 (AF7)
+    { USART1_BASE, Port::A, 9, 7 },  { USART1_BASE, Port::A, 10, 7 },
+    { USART1_BASE, Port::B, 6, 7 },  { USART1_BASE, Port::B, 7, 7 },
+    { USART2_BASE, Port::A, 2, 7 },  { USART2_BASE, Port::A, 3, 7 },
+    { USART3_BASE, Port::B, 10, 7 }, { USART3_BASE, Port::C, 5, 7 },
+    { USART3_BASE, Port::C, 10, 7 }, { USART3_BASE, Port::C, 11, 7 },
+    // UART4/5, USART6 (AF8)
+    { UART4_BASE, Port::A, 0, 8 },   { UART4_BASE, Port::A, 1, 8 },
+    { UART4_BASE, Port::C, 10, 8 },  { UART4_BASE, Port::C, 11, 8 },
+    { UART5_BASE, Port::C, 12, 8 },  { UART5_BASE, Port::D, 2, 8 },
+    { USART6_BASE, Port::C, 6, 8 },  { USART6_BASE, Port::C, 7, 8 },
+    { USART6_BASE, Port::A, 11, 8 }, { USART6_BASE, Port::A, 12, 8 },
+    // SPI1/2 (AF5), SPI3 (AF6)
+    { SPI1_BASE, Port::A, 4, 5 },  { SPI1_BASE, Port::A, 5, 5 },  { SPI1_BASE, Port::A, 6, 5 },
+    { SPI1_BASE, Port::A, 7, 5 },  { SPI1_BASE, Port::A, 15, 5 }, { SPI1_BASE, Port::B, 3, 5 },
+    { SPI1_BASE, Port::B, 4, 5 },  { SPI1_BASE, Port::B, 5, 5 },
+    { SPI2_BASE, Port::B, 10, 5 }, { SPI2_BASE, Port::B, 12, 5 }, { SPI2_BASE, Port::B, 13, 5 },
+    { SPI2_BASE, Port::B, 14, 5 }, { SPI2_BASE, Port::B, 15, 5 }, { SPI2_BASE, Port::C, 2, 5 },
+    { SPI2_BASE, Port::C, 3, 5 },
+    { SPI3_BASE, Port::A, 4, 6 },  { SPI3_BASE, Port::A, 15, 6 }, { SPI3_BASE, Port::B, 3, 6 },
+    { SPI3_BASE, Port::B, 4, 6 },  { SPI3_BASE, Port::B, 5, 6 },  { SPI3_BASE, Port::C, 10, 6 },
+    { SPI3_BASE, Port::C, 11, 6 }, { SPI3_BASE, Port::C, 12, 6 },
+};
+
+/**
+ * @brief Looks up the AF number that connects `periph` to a pin.
+ *
+ * @return int AF number 0–15, or -1 if the pin can't carry that peripheral.
+ */
+constexpr int af_lookup(uintptr_t periph, Port p, uint8_t n) {
+    for (const AfEntry &e : af_table) {
+        if (e.periph == periph && e.port == p && e.pin == n) return e.af;
+    }
+    return -1;
+}
+
+/**
+ * @brief Whether a base address is one of the six U(S)ARTs.
+ */
+constexpr bool is_uart(uintptr_t base) {
+    return base == USART1_BASE || base == USART2_BASE || base == USART3_BASE ||
+           base == UART4_BASE  || base == UART5_BASE  || base == USART6_BASE;
+}
+
+/**
+ * @brief Whether a base address is one of the fourteen timers.
+ */
+constexpr bool is_timer(uintptr_t base) {
+    return base == TIM1_BASE  || base == TIM2_BASE  || base == TIM3_BASE  || base == TIM4_BASE  ||
+           base == TIM5_BASE  || base == TIM6_BASE  || base == TIM7_BASE  || base == TIM8_BASE  ||
+           base == TIM9_BASE  || base == TIM10_BASE || base == TIM11_BASE || base == TIM12_BASE ||
+           base == TIM13_BASE || base == TIM14_BASE;
+}
+
+/**
+ * @brief Number of capture/compare channels of a timer (0 for basic timers).
+ */
+constexpr uint8_t timer_channels(uintptr_t base) {
+    return (base == TIM6_BASE || base == TIM7_BASE) ? 0 :
+           (base == TIM10_BASE || base == TIM11_BASE || base == TIM13_BASE || base == TIM14_BASE) ? 1 :
+           (base == TIM9_BASE || base == TIM12_BASE) ? 2 : 4;
+}
+
+} // namespace detail
+
+/**
+ * @brief A single GPIO pin, fully resolved at compile time.
+ *
+ * @tparam P Port letter.
+ * @tparam N Pin number 0–15.
+ */
+template <Port P, uint8_t N>
+struct Pin {
+    static_assert(N < 16, "GPIO pin number must be 0-15");
+    static_assert(detail::pin_exists(P, N), "pin is not available on the STM32F446RE LQFP64 package");
+
+    static constexpr uintptr_t base = detail::gpio_base(P);   ///< Port base address
+    static constexpr uint32_t mask = 1U << N;                  ///< Bit of this pin in IDR/ODR/BSRR
+
+    /// Port registers.
+    HAL_INLINE GPIO_TypeDef *regs() { return reinterpret_cast<GPIO_TypeDef *>(base); }
+
+    /// Drives the pin high (one store to BSRR).
+    HAL_INLINE void set() { regs()->BSRR = mask; }
+
+    /// Drives the pin low (one store to BSRR).
+    HAL_INLINE void clear() { regs()->BSRR = mask << 16; }
+
+    /// Drives the pin to `level`.
+    HAL_INLINE void write(bool level) { regs()->BSRR = level ? mask : (mask << 16); }
+
+    /// Inverts the output level (one ODR read, one BSRR store, no branch).
+    HAL_INLINE void toggle() {
+        uint32_t odr = regs()->ODR;
+        regs()->BSRR = ((odr & mask) << 16) | (~odr & mask);
+    }
+
+    /// Reads the input level.
+    HAL_INLINE bool read() { return (regs()->IDR & mask) != 0; }
+
+    /// Enables the port clock in `RCC->AHB1ENR`.
+    HAL_INLINE void clock_enable() { RCC->AHB1ENR |= 1U << static_cast<uint8_t>(P); }
+
+    /// Sets MODER for this pin.
+    HAL_INLINE void mode(gpio_mode_t m) {
+        regs()->MODER = (regs()->MODER & ~(0x3U << (2 * N))) | ((static_cast<uint32_t>(m) & 0x3U) << (2 * N));
+    }
+
+    /// Configures the pin as a push-pull output.
+    HAL_INLINE void output() {
+        regs()->OTYPER &= ~mask;
+        mode(GPIO_MODE_OUTPUT);
+    }
+
+    /// Configures the pin as an input with the given pull.
+    HAL_INLINE void input(gpio_pupdr_t pull = GPIO_NO_PULL) {
+        regs()->PUPDR = (regs()->PUPDR & ~(0x3U << (2 * N))) | ((static_cast<uint32_t>(pull) & 0x3U) << (2 * N));
+        mode(GPIO_MODE_INPUT);
+    }
+
+    /**
+     * @brief Connects the pin to a peripheral; the AF number is found at compile time.
+     *
+     * @tparam Periph Peripheral base address (e.g., `USART2_BASE`).
+     */
+    template <uintptr_t Periph>
+    HAL_INLINE void alt() {
+        constexpr int af = detail::af_lookup(Periph, P, N);
+        static_assert(af >= 0, "this pin cannot be routed to that peripheral (no AF mapping)");
+
+        volatile uint32_t &afr = (N < 8) ? regs()->AFRL : regs()->AFRH;
+        afr = (afr & ~(0xFU << (4 * (N & 7)))) | (static_cast<uint32_t>(af) << (4 * (N & 7)));
+        regs()->OSPEEDR |= 0x3U << (2 * N);
+        mode(GPIO_MODE_ALTFUNC);
+    }
+};
+
+/**
+ * @brief A U(S)ART selected by base address.
+ *
+ * @tparam Base `USART1_BASE` ... `USART6_BASE`.
+ */
+template <uintptr_t Base>
+struct Uart {
+    static_assert(detail::is_uart(Base), "Uart<> needs a USART/UART base address");
+
+    /// Peripheral registers.
+    HAL_INLINE UART_TypeDef *regs() { return reinterpret_cast<UART_TypeDef *>(Base); }
+
+    /**
+     * @brief Routes TX and RX pins to this UART (checked at compile time).
+     *
+     * @tparam Tx Pin type for TX.
+     * @tparam Rx Pin type for RX.
+     */
+    template <typename Tx, typename Rx>
+    HAL_INLINE void pins() {
+        Tx::template alt<Base>();
+        Rx::template alt<Base>();
+    }
+
+    /// Sets the baud rate (oversampling by 16, rounded) and enables TX/RX.
+    HAL_INLINE void init(uint32_t pclk_hz, uint32_t baud) {
+        regs()->BRR = (pclk_hz + baud / 2U) / baud;
+        regs()->CR1 = USART_CR1_TE | USART_CR1_RE | USART_CR1_UE;
+    }
+
+    /// Whether the data register can take another byte.
+    HAL_INLINE bool writable() { return (regs()->SR & USART_SR_TXE) != 0; }
+
+    /// Whether a received byte is waiting.
+    HAL_INLINE bool readable() { return (regs()->SR & USART_SR_RXNE) != 0; }
+
+    /// Blocking write of one byte (polled; do not mix with the C driver's DMA ring on the same port).
+    HAL_INLINE void put(uint8_t c) {
+        while (!writable());
+        regs()->DR = c;
+    }
+
+    /// Blocking read of one byte (polled).
+    HAL_INLINE uint8_t get() {
+        while (!readable());
+        return static_cast<uint8_t>(regs()->DR);
+    }
+};
+
+/**
+ * @brief A timer selected by base address.
+ *
+ * @tparam Base `TIM1_BASE` ... `TIM14_BASE`.
+ */
+template <uintptr_t Base>
+struct Timer {
+    static_assert(detail::is_timer(Base), "Timer<> needs a TIM base address");
+
+    static constexpr uint8_t channels = detail::timer_channels(Base);   ///< Capture/compare channels
+
+    /// Peripheral registers.
+    HAL_INLINE TIM_TypeDef *regs() { return reinterpret_cast<TIM_TypeDef *>(Base); }
+
+    /// Sets PSC and ARR from raw dividers (1–65536) and loads them immediately.
+    HAL_INLINE void configure(uint32_t prescaler, uint32_t period) {
+        regs()->PSC = prescaler - 1U;
+        regs()->ARR = period - 1U;
+        regs()->EGR = TIM_EGR_UG;
+    }
+
+    /// Starts the counter.
+    HAL_INLINE void start() { regs()->CR1 |= TIM_CR1_CEN; }
+
+    /// Stops the counter.
+    HAL_INLINE void stop() { regs()->CR1 &= ~TIM_CR1_CEN; }
+
+    /// Current counter value.
+    HAL_INLINE uint32_t count() { return regs()->CNT; }
+
+    /**
+     * @brief Writes a compare value (one store to CCRx).
+     *
+     * @tparam Ch Channel 1–4; must exist on this timer.
+     */
+    template <uint8_t Ch>
+    HAL_INLINE void compare(uint32_t value) {
+        static_assert(Ch >= 1 && Ch <= channels, "timer has no such capture/compare channel");
+        (&regs()->CCR1)[Ch - 1] = value;
+    }
+};
+
+} // namespace hal
+
+#undef HAL_INLINE
+
+#endif // HAL_HPP
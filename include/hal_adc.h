@@ -0,0 +1,140 @@
+/**
+ * @file hal_adc.h
+ * @brief ADC HAL interface for STM32F446RE (scan, timer trigger, circular DMA).
+ *
+ * Drives ADC1–ADC3 with a regular sequence of up to 16 channels. A sequence
+ * is started either once by software and then free-runs (continuous mode), or
+ * on every TRGO of TIM2, TIM3 or TIM8, which gives a jitter-free sample rate
+ * set by `adc_set_trigger_rate()`. Results go by DMA into a circular buffer;
+ * the half/full callbacks hand out the half that is no longer being written,
+ * so the CPU only runs once per half buffer.
+ *
+ * The ADC clock is PCLK2 divided down to at most 36 MHz (22.5 MHz at 180 MHz
+ * HCLK). One conversion takes the sampling time plus 12 cycles at 12 bits, so
+ * a single ADC reaches 1.5 MSa/s with `ADC_SMP_3`; the dual and triple
+ * interleaved modes stagger ADC1–ADC3 on one channel for up to 3× that.
+ *
+ * DMA streams (DMA2): ADC1 stream 4, ADC2 stream 3, ADC3 stream 1. They are
+ * shared with TIM1 CH4 / TIM8 CH3, SPI1 TX / TIM8 CH2 and SPI4 TX / TIM1 CH1 /
+ * TIM8_UP respectively. Interleaved modes use the ADC1 stream only.
+ *
+ * @code
+ * // 4 channels at 10 kHz each, TIM3-triggered, 2 × 64 sequences
+ * static const uint8_t ch[] = { 0, 1, 4, 8 };
+ * static uint16_t buf[2 * 64 * 4];
+ *
+ * adc_config_t cfg = { ch, 4, ADC_SMP_56, ADC_RES_12BIT, ADC_TRIG_TIM3_TRGO };
+ * adc_init(ADC1, &cfg);
+ * adc_start_dma(ADC1, buf, sizeof buf / 2, on_block, 0);   // on_block(adc, half, ctx)
+ * adc_set_trigger_rate(ADC_TRIG_TIM3_TRGO, 10000);
+ * @endcode
+ */
+
+#ifndef HAL_ADC_H
+#define HAL_ADC_H
+
+#include <stdint.h>
+#include "stm32f4_adc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Buffer callback, called from the DMA stream interrupt.
+ *
+ * @param adc  ADC that produced the data (ADC1 for interleaved modes).
+ * @param half Half of the buffer that is now complete and safe to read:
+ *             0 = first half, 1 = second half.
+ * @param ctx  User pointer given to the start function.
+ */
+typedef void (*adc_callback_t)(ADC_TypeDef *adc, uint8_t half, void *ctx);
+
+/**
+ * @brief Powers up an ADC and programs its regular sequence.
+ *
+ * Enables the ADC clock, sets the common prescaler, the resolution, the
+ * sequence (scan mode when `count` > 1), the sampling time of each channel
+ * and the trigger source. Conversions do not start until `adc_read()` or a
+ * start function is called.
+ *
+ * @param adc ADC instance (ADC1, ADC2 or ADC3).
+ * @param cfg Sequence and conversion settings.
+ * @return int 0 on success, -1 on an invalid instance, channel or length.
+ */
+int adc_init(ADC_TypeDef *adc, const adc_config_t *cfg);
+
+/**
+ * @brief Converts one channel by software and waits for the result.
+ *
+ * Replaces the programmed sequence with the single channel, so call it only
+ * while no DMA acquisition is running; run `adc_init()` again afterwards.
+ *
+ * @param adc ADC instance (initialized).
+ * @param channel Channel number 0–18.
+ * @return uint16_t Conversion result, right aligned.
+ */
+uint16_t adc_read(ADC_TypeDef *adc, uint8_t channel);
+
+/**
+ * @brief Starts continuous acquisition into a circular DMA buffer.
+ *
+ * The sequence results are written back to back, so with a sequence of `n`
+ * channels sample `k` of channel `i` is at `buf[k * n + i]` when `len` is a
+ * multiple of `2 * n`. With a software trigger the ADC free-runs; with a
+ * timer trigger one sequence runs per TRGO.
+ *
+ * @param adc ADC instance (initialized).
+ * @param buf Sample buffer.
+ * @param len Number of samples in `buf` (2–65534, even).
+ * @param cb  Half/full callback, or 0.
+ * @param ctx User pointer passed to `cb`.
+ * @return int 0 if started, -1 on invalid arguments.
+ */
+int adc_start_dma(ADC_TypeDef *adc, uint16_t *buf, uint16_t len, adc_callback_t cb, void *ctx);
+
+/**
+ * @brief Stops conversions and DMA for an ADC and returns it to independent mode.
+ *
+ * For an interleaved acquisition pass ADC1; the slave ADCs are stopped too.
+ * The ADC's DMA stream is disabled only if the ADC was using it.
+ *
+ * @param adc ADC instance.
+ */
+void adc_stop(ADC_TypeDef *adc);
+
+/**
+ * @brief Runs the trigger timer at a given rate with TRGO on its update event.
+ *
+ * @param trigger Timer trigger used in the ADC configuration.
+ * @param rate_hz Sequences per second.
+ * @return int 0 if the rate is exact, 1 if approximate, -1 on error.
+ */
+int adc_set_trigger_rate(adc_trigger_t trigger, uint32_t rate_hz);
+
+/**
+ * @brief Starts dual or triple interleaved acquisition of one channel.
+ *
+ * ADC1 (master) and ADC2 (plus ADC3 in triple mode) are initialized with
+ * `cfg` and convert in turn, `delay_cycles` ADC clocks apart, so the aggregate
+ * rate is up to 2× or 3× that of one ADC. The common data register hands over
+ * two results per DMA transfer (DMA mode 2); they land in `buf` in conversion
+ * order. The trigger in `cfg` applies to the master only.
+ *
+ * @param mode Dual or triple interleaved.
+ * @param cfg Single-channel configuration (`count` must be 1).
+ * @param delay_cycles Delay between the ADCs' sampling phases, 5–20 ADC clocks.
+ * @param buf Sample buffer, 32-bit aligned.
+ * @param len Number of samples in `buf` (multiple of 4, up to 65532).
+ * @param cb  Half/full callback, or 0.
+ * @param ctx User pointer passed to `cb`.
+ * @return int 0 if started, -1 on invalid arguments.
+ */
+int adc_multi_start_dma(adc_multi_mode_t mode, const adc_config_t *cfg, uint8_t delay_cycles,
+                        uint16_t *buf, uint16_t len, adc_callback_t cb, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_ADC_H
@@ -0,0 +1,131 @@
+/**
+ * @file hal_bitband.h
+ * @brief Cortex-M4 bit-band access for peripheral registers and SRAM.
+ *
+ * Every bit of the first 1 MB of SRAM (0x20000000) and of the peripheral space
+ * (0x40000000) has a 32-bit alias word: writing 0/1 to the alias clears/sets
+ * just that bit, and reading it returns the bit. The bus performs the
+ * read-modify-write as one locked transfer, so a single store updates a bit
+ * atomically with respect to interrupts and DMA without masking IRQs.
+ *
+ * All APB1/APB2/AHB1 peripherals of the STM32F446RE (RCC, GPIO, TIM, USART,
+ * SPI, DMA, ...) lie in the peripheral bit-band region; the 128 KB of SRAM
+ * lies entirely in the SRAM region.
+ *
+ * @warning Don't use bit-band writes to clear "rc_w0" status flags (e.g.
+ * `TIMx->SR`, `USART->SR`): the hidden read-modify-write can write back 0 to a
+ * flag the hardware set in between and lose it. Clear those with a single
+ * store of the inverted mask instead (`TIMx->SR = ~TIM_SR_UIF`).
+ *
+ * @code
+ * BITBAND_PERIPH(&RCC->APB1ENR, 17) = 1;     // USART2EN, one store
+ * if (BITBAND_PERIPH(&GPIOC->IDR, 13)) ...   // read one input bit
+ *
+ * static BITBAND_FLAGS(ready, 64);           // 64 flags in SRAM
+ * bitband_flag_set(ready, 40);              // atomic, ISR-safe
+ * @endcode
+ */
+
+#ifndef HAL_BITBAND_H
+#define HAL_BITBAND_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @name Bit-band regions
+/// @{
+#define BITBAND_SRAM_BASE     0x20000000UL  /**< Start of the SRAM bit-band region */
+#define BITBAND_SRAM_ALIAS    0x22000000UL  /**< Start of the SRAM alias region */
+#define BITBAND_PERIPH_BASE   0x40000000UL  /**< Start of the peripheral bit-band region */
+#define BITBAND_PERIPH_ALIAS  0x42000000UL  /**< Start of the peripheral alias region */
+/// @}
+
+/**
+ * @brief Alias word of bit `bit` of a peripheral register (lvalue).
+ *
+ * @param reg Register address (e.g., `&RCC->AHB1ENR`).
+ * @param bit Bit number 0–31.
+ */
+#define BITBAND_PERIPH(reg, bit) \
+    (*(volatile uint32_t *)(BITBAND_PERIPH_ALIAS + \
+        (((uint32_t)(uintptr_t)(reg) - BITBAND_PERIPH_BASE) << 5) + ((uint32_t)(bit) << 2)))
+
+/**
+ * @brief Alias word of bit `bit` of an SRAM word (lvalue).
+ *
+ * @param addr Address of a word in SRAM.
+ * @param bit  Bit number 0–31.
+ */
+#define BITBAND_SRAM(addr, bit) \
+    (*(volatile uint32_t *)(BITBAND_SRAM_ALIAS + \
+        (((uint32_t)(uintptr_t)(addr) - BITBAND_SRAM_BASE) << 5) + ((uint32_t)(bit) << 2)))
+
+/**
+ * @brief Declares an array of `nbits` flags in SRAM for use with `bitband_flag_*()`.
+ *
+ * @param name  Array name.
+ * @param nbits Number of flags.
+ */
+#define BITBAND_FLAGS(name, nbits) uint32_t name[((nbits) + 31U) / 32U]
+
+/**
+ * @brief Atomically sets or clears one bit of a peripheral register.
+ *
+ * @param reg   Register address.
+ * @param bit   Bit number 0–31.
+ * @param value 0 clears, non-zero sets.
+ */
+static inline void bitband_write(volatile uint32_t *reg, uint8_t bit, uint32_t value) {
+    BITBAND_PERIPH(reg, bit) = value ? 1U : 0U;
+}
+
+/**
+ * @brief Reads one bit of a peripheral register.
+ *
+ * @param reg Register address.
+ * @param bit Bit number 0–31.
+ * @return uint32_t 1 if set, 0 otherwise.
+ */
+static inline uint32_t bitband_read(volatile uint32_t *reg, uint8_t bit) {
+    return BITBAND_PERIPH(reg, bit);
+}
+
+/**
+ * @brief Atomically sets flag `n` of an SRAM flag array.
+ *
+ * @param flags Array declared with `BITBAND_FLAGS`.
+ * @param n     Flag index.
+ */
+static inline void bitband_flag_set(uint32_t *flags, uint32_t n) {
+    BITBAND_SRAM(&flags[n >> 5], n & 31U) = 1U;
+}
+
+/**
+ * @brief Atomically clears flag `n` of an SRAM flag array.
+ *
+ * @param flags Array declared with `BITBAND_FLAGS`.
+ * @param n     Flag index.
+ */
+static inline void bitband_flag_clear(uint32_t *flags, uint32_t n) {
+    BITBAND_SRAM(&flags[n >> 5], n & 31U) = 0U;
+}
+
+/**
+ * @brief Reads flag `n` of an SRAM flag array.
+ *
+ * @param flags Array declared with `BITBAND_FLAGS`.
+ * @param n     Flag index.
+ * @return uint32_t 1 if set, 0 otherwise.
+ */
+static inline uint32_t bitband_flag_test(const uint32_t *flags, uint32_t n) {
+    return BITBAND_SRAM(&flags[n >> 5], n & 31U);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_BITBAND_H
@@ -0,0 +1,118 @@
+/**
+ * @file hal_dac.h
+ * @brief DAC HAL interface for STM32F446RE (static output, DMA waveforms, noise/triangle).
+ *
+ * Drives DAC OUT1 (PA4) and OUT2 (PA5). Waveforms are paced by TIM6 or TIM7:
+ * the timer's update event is its TRGO, and on every TRGO the DAC loads the
+ * next sample, which the DMA has already fetched from a circular table. The
+ * sample rate is solved into PSC/ARR from the real APB1 timer clock, so the
+ * output timing is set by hardware and the CPU is not involved after start.
+ *
+ * The built-in generators add pseudo-random noise or a triangle on top of a
+ * DC offset, with no sample table at all.
+ *
+ * DMA streams (DMA1 channel 7): OUT1 stream 5, OUT2 stream 6. Stream 5 is
+ * shared with SPI3 TX and TIM2 CH1 / TIM3 CH2, stream 6 with USART2 TX and
+ * TIM2 CH2 / TIM4_UP. TIM6/TIM7 are also the periodic task dispatcher timers
+ * (`hal_task.h`); a timer can serve only one of the two.
+ *
+ * @code
+ * // 1 kHz sine from a 100-point table (100 kSa/s) on PA4, noise on PA5
+ * static uint16_t sine[100];   // 0..4095
+ *
+ * dac_init(DAC_CHANNEL_1);
+ * dac_start_dma(DAC_CHANNEL_1, sine, 100, DAC_TRIG_TIM6_TRGO, 100000);
+ *
+ * dac_init(DAC_CHANNEL_2);
+ * dac_start_wave(DAC_CHANNEL_2, DAC_WAVE_NOISE, 11, 0, DAC_TRIG_TIM7_TRGO, 200000);
+ * @endcode
+ */
+
+#ifndef HAL_DAC_H
+#define HAL_DAC_H
+
+#include <stdint.h>
+#include "stm32f4_dac.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enables a DAC channel with its output buffer, output at 0.
+ *
+ * Enables the DAC and GPIOA clocks and puts the channel's pin in analog mode.
+ *
+ * @param ch Channel.
+ */
+void dac_init(dac_channel_t ch);
+
+/**
+ * @brief Sets a static output level (untriggered channels only).
+ *
+ * @param ch Channel.
+ * @param value 12-bit code, 0–4095.
+ */
+void dac_write(dac_channel_t ch, uint16_t value);
+
+/**
+ * @brief Plays a sample table in a loop, one sample per trigger.
+ *
+ * The output frequency of one table period is `sample_rate_hz / len`. The
+ * table is read by DMA while playing and may be rewritten in place.
+ *
+ * @param ch Channel (initialized).
+ * @param buf 12-bit right-aligned samples.
+ * @param len Number of samples (1–65535).
+ * @param trig TIM6 or TIM7; the timer is configured and started.
+ * @param sample_rate_hz Samples per second.
+ * @return int 0 if the rate is exact, 1 if approximate, -1 on error.
+ */
+int dac_start_dma(dac_channel_t ch, const uint16_t *buf, uint16_t len,
+                  dac_trigger_t trig, uint32_t sample_rate_hz);
+
+/**
+ * @brief Starts the noise or triangle generator.
+ *
+ * `amplitude` selects the MAMP field: noise unmasks LFSR bits 0..amplitude,
+ * triangle counts between 0 and 2^(amplitude + 1) − 1. Both are added to
+ * `offset` (saturating at 4095). A triangle period is
+ * 2 × (2^(amplitude + 1) − 1) steps.
+ *
+ * @param ch Channel (initialized).
+ * @param wave Noise or triangle.
+ * @param amplitude 0–11.
+ * @param offset DC offset, 12-bit code.
+ * @param trig TIM6 or TIM7; the timer is configured and started.
+ * @param step_rate_hz Generator steps per second.
+ * @return int 0 if the rate is exact, 1 if approximate, -1 on error.
+ */
+int dac_start_wave(dac_channel_t ch, dac_wave_t wave, uint8_t amplitude, uint16_t offset,
+                   dac_trigger_t trig, uint32_t step_rate_hz);
+
+/**
+ * @brief Stops triggered output; the channel holds its last sample (or the wave offset).
+ *
+ * The trigger timer keeps running, since the other channel may use it.
+ *
+ * @param ch Channel.
+ */
+void dac_stop(dac_channel_t ch);
+
+/**
+ * @brief Reports and clears a DMA underrun.
+ *
+ * Set when a trigger arrives before the previous DMA request was served;
+ * the DAC then stops requesting, so a playback with an underrun must be
+ * restarted with `dac_start_dma()`.
+ *
+ * @param ch Channel.
+ * @return int 1 if an underrun happened since the last call, else 0.
+ */
+int dac_underrun(dac_channel_t ch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_DAC_H
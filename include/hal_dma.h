@@ -0,0 +1,96 @@
+/**
+ * @file hal_dma.h
+ * @brief DMA stream helpers for STM32F446RE peripheral drivers.
+ *
+ * Thin helpers shared by the UART, SPI and other drivers that move data with
+ * the DMA1/DMA2 controllers: stream lookup, safe disable, per-stream flag
+ * access without hand-computing LISR/HISR bit offsets, and dispatch of the
+ * 16 stream interrupts to per-stream callbacks.
+ */
+
+#ifndef HAL_DMA_H
+#define HAL_DMA_H
+
+#include <stdint.h>
+#include "stm32f4_dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Stream interrupt callback type.
+ *
+ * Called from the stream's IRQ with the flags that were pending (already cleared).
+ *
+ * @param flags Combination of `DMA_FLAG_*` bits (e.g. `DMA_FLAG_TCIF`).
+ * @param ctx   User pointer given to `dma_stream_attach()`.
+ */
+typedef void (*dma_callback_t)(uint32_t flags, void *ctx);
+
+/**
+ * @brief Returns the register block of a DMA stream.
+ *
+ * @param req DMA request mapping (controller + stream).
+ * @return DMA_Stream_TypeDef* Pointer to the stream registers.
+ */
+DMA_Stream_TypeDef *dma_stream_get(const dma_request_t *req);
+
+/**
+ * @brief Disables a DMA stream and waits until the hardware confirms it.
+ *
+ * The stream registers can only be reprogrammed once `EN` reads back as 0.
+ *
+ * @param req DMA request mapping.
+ */
+void dma_stream_disable(const dma_request_t *req);
+
+/**
+ * @brief Reads the interrupt flags of a stream, normalized to `DMA_FLAG_*`.
+ *
+ * @param req DMA request mapping.
+ * @return uint32_t Combination of `DMA_FLAG_*` bits.
+ */
+uint32_t dma_stream_flags(const dma_request_t *req);
+
+/**
+ * @brief Clears interrupt flags of a stream.
+ *
+ * @param req   DMA request mapping.
+ * @param flags Combination of `DMA_FLAG_*` bits to clear.
+ */
+void dma_stream_clear_flags(const dma_request_t *req, uint32_t flags);
+
+/**
+ * @brief Programs and enables a stream for a transfer.
+ *
+ * Disables the stream, clears its flags, selects the request channel, then
+ * loads addresses and count before setting `EN`. Passing `DMA_SxCR_CIRC` in
+ * `cr` makes the stream reload `count` and wrap instead of stopping.
+ *
+ * @param req    DMA request mapping.
+ * @param cr     Stream configuration bits (`DMA_SxCR_*`), without CHSEL or EN.
+ * @param periph Peripheral data register address.
+ * @param mem    Memory buffer address.
+ * @param count  Number of data items to transfer (1–65535).
+ */
+void dma_stream_start(const dma_request_t *req, uint32_t cr,
+                      volatile void *periph, const void *mem, uint16_t count);
+
+/**
+ * @brief Routes a stream's interrupt to a callback and enables its NVIC line.
+ *
+ * The driver still chooses which events interrupt by setting `DMA_SxCR_TCIE`,
+ * `DMA_SxCR_HTIE` or `DMA_SxCR_TEIE` in the stream configuration.
+ *
+ * @param req DMA request mapping.
+ * @param cb  Callback, or 0 to detach (the NVIC line is then disabled).
+ * @param ctx User pointer passed back to `cb`.
+ */
+void dma_stream_attach(const dma_request_t *req, dma_callback_t cb, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_DMA_H
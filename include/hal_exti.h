@@ -0,0 +1,88 @@
+/**
+ * @file hal_exti.h
+ * @brief GPIO external interrupt (EXTI) driver for STM32F446RE.
+ *
+ * Maps a packed pin (`PIN('C', 13)`) to its EXTI line, selects the port in
+ * SYSCFG, configures the trigger edge(s) and dispatches to a per-line callback
+ * from the EXTI0–EXTI4, EXTI9_5 and EXTI15_10 vectors. The shared vectors read
+ * the pending register once and serve every pending line in one pass.
+ *
+ * Optional debounce: after an accepted edge the line is masked, so contact
+ * bounce raises no further interrupts, and a one-shot software timer
+ * (`hal_timer`) unmasks it when the debounce window has passed. The ISR does
+ * no per-bounce work; the unmask runs from `hal_timer_process()`.
+ *
+ * The pin must be configured as input separately (e.g., `gpio_init()` with a pull).
+ *
+ * @code
+ * static void on_button(uint16_t pin, void *ctx) { gpio_write(PIN('A', 5), !gpio_read(PIN('A', 5))); }
+ *
+ * exti_attach(PIN('C', 13), EXTI_EDGE_FALLING, on_button, 0);
+ * exti_set_debounce(PIN('C', 13), 20);
+ * @endcode
+ */
+
+#ifndef HAL_EXTI_H
+#define HAL_EXTI_H
+
+#include <stdint.h>
+#include "stm32f4_exti.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief EXTI callback type, called from the EXTI interrupt.
+ *
+ * @param pin Packed pin that triggered.
+ * @param ctx User pointer given to `exti_attach()`.
+ */
+typedef void (*exti_callback_t)(uint16_t pin, void *ctx);
+
+/**
+ * @brief Routes a pin to its EXTI line and enables the interrupt.
+ *
+ * Enables the SYSCFG clock, selects the pin's port for the line, sets the
+ * trigger edge(s), clears any stale pending flag, unmasks the line and enables
+ * its NVIC vector.
+ *
+ * @param pin  Packed pin (port << 8 | number).
+ * @param edge Rising, falling or both.
+ * @param cb   Callback, run in interrupt context.
+ * @param ctx  User pointer passed to `cb`.
+ * @return int 0 on success, -1 if the line is already attached to another port.
+ */
+int exti_attach(uint16_t pin, exti_edge_t edge, exti_callback_t cb, void *ctx);
+
+/**
+ * @brief Masks the pin's EXTI line and removes its callback.
+ *
+ * Does nothing if the line is attached to another port (or not at all).
+ *
+ * @param pin Packed pin.
+ */
+void exti_detach(uint16_t pin);
+
+/**
+ * @brief Enables or disables debounce on an attached line.
+ *
+ * @param pin Packed pin.
+ * @param ms  Window in milliseconds during which further edges are ignored
+ *            (0 disables). Needs `hal_tick_init()` and a main loop calling
+ *            `hal_timer_process()`.
+ */
+void exti_set_debounce(uint16_t pin, uint32_t ms);
+
+/**
+ * @brief Triggers a line from software (SWIER), e.g. for testing.
+ *
+ * @param pin Packed pin.
+ */
+void exti_trigger(uint16_t pin);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_EXTI_H
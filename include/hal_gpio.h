@@ -14,8 +14,13 @@
 #define HAL_GPIO_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "stm32f4_gpio.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * @brief Initialize a GPIO pin with a specified configuration.
  *
@@ -25,6 +30,29 @@
  */
 void gpio_init(gpio_config_t cfg);
 
+/**
+ * @brief Initialize a whole board's pins from a const table.
+ *
+ * Enables the clocks of every port used with a single `RCC->AHB1ENR` write,
+ * then for each port builds the final OTYPER/OSPEEDR/PUPDR/AFRL/AFRH/MODER
+ * images from all of its entries and writes each register once. MODER is
+ * written last, so pins only switch mode once their AF and electrical settings
+ * are in place. Pins not listed keep their current configuration.
+ *
+ * @param cfgs Pin configurations, including `af` for alternate-function pins.
+ * @param n    Number of entries.
+ *
+ * @code
+ * static const gpio_config_t board_pins[] = {
+ *     { PIN('A', 2), GPIO_MODE_ALTFUNC, GPIO_OTYPE_PUSHPULL, GPIO_SPEED_HIGH, GPIO_NO_PULL, 7 },  // USART2_TX
+ *     { PIN('A', 5), GPIO_MODE_OUTPUT,  GPIO_OTYPE_PUSHPULL, GPIO_SPEED_LOW,  GPIO_NO_PULL, 0 },  // LED
+ *     { PIN('C', 13), GPIO_MODE_INPUT,  GPIO_OTYPE_PUSHPULL, GPIO_SPEED_LOW,  GPIO_PULL_UP, 0 },  // button
+ * };
+ * gpio_init_table(board_pins, sizeof(board_pins) / sizeof(board_pins[0]));
+ * @endcode
+ */
+void gpio_init_table(const gpio_config_t *cfgs, size_t n);
+
 /**
  * @brief Configure the alternate function for a GPIO pin.
  *
@@ -63,4 +91,28 @@ int gpio_read(uint16_t gpio_pin);
  */
 void gpio_write(uint16_t gpio_pin, uint8_t state);
 
+/**
+ * @brief Update several pins of one port in a single BSRR write.
+ *
+ * Pins in `mask` take the level of the matching bit in `value`; other pins
+ * are untouched. Atomic with respect to interrupts and other pins.
+ *
+ * @param port  Port index (e.g., `GPIO_PORT_A`).
+ * @param mask  Pins to update (bit n = pin n).
+ * @param value New levels for the pins in `mask`.
+ */
+void gpio_write_mask(gpio_port_t port, uint16_t mask, uint16_t value);
+
+/**
+ * @brief Sample all 16 pins of a port with a single IDR read.
+ *
+ * @param port Port index (e.g., `GPIO_PORT_C`).
+ * @return uint16_t Input levels (bit n = pin n).
+ */
+uint16_t gpio_read_port(gpio_port_t port);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // HAL_GPIO_H
@@ -0,0 +1,144 @@
+/**
+ * @file hal_i2c.h
+ * @brief Interrupt/DMA-driven I2C master with a transaction queue for STM32F446RE.
+ *
+ * Each I2C peripheral runs one transaction at a time from its event/error
+ * interrupts: an optional write phase, then an optional read phase after a
+ * repeated start (write-then-read register access). Transactions are
+ * described by caller-provided `i2c_xfer_t` objects (no heap) and submitted
+ * to a fixed-size per-bus queue, so several callers can share a bus without
+ * waiting; each finishes with a status and an optional callback.
+ *
+ * Payloads of `I2C_DMA_MIN_LEN` bytes or more are moved by DMA, shorter ones
+ * byte by byte from the buffer interrupt. A queued transaction follows the
+ * previous one with a repeated start instead of a stop, so the bus is never
+ * released between queued transactions.
+ *
+ * A NACK ends the transaction with a stop and `I2C_STATUS_NACK`; bus errors
+ * and lost arbitration reset the peripheral (SWRST) from the error interrupt
+ * and fail the transaction. The queue keeps running in both cases. A slave
+ * holding SDA low is not freed by SWRST; that needs SCL clocked by GPIO.
+ *
+ * DMA streams (DMA1): I2C1 TX 7 / RX 0 (channel 1), I2C2 TX 7 / RX 3
+ * (channel 7), I2C3 TX 4 / RX 2 (channel 3). A stream is borrowed per
+ * payload only if it is idle, otherwise that payload falls back to byte
+ * interrupts (I2C1 and I2C2 share stream 7). An RX payload takes over the
+ * stream's interrupt callback, so it must not be shared with a driver that
+ * keeps one attached (SPI2 RX and USART3 TX on stream 3).
+ *
+ * SCL/SDA pins must be configured beforehand as alternate function 4,
+ * open-drain (e.g. PB8/PB9 for I2C1).
+ *
+ * @code
+ * static uint8_t reg = 0x3B, data[14];
+ * static i2c_xfer_t rd = { .addr = 0x68, .tx = &reg, .tx_len = 1, .rx = data, .rx_len = 14 };
+ *
+ * i2c_init(I2C1, 400000);
+ * i2c_submit(I2C1, &rd);
+ * // ... later, or from rd.cb:
+ * if (rd.status == I2C_STATUS_DONE) use(data);
+ * @endcode
+ */
+
+#ifndef HAL_I2C_H
+#define HAL_I2C_H
+
+#include <stdint.h>
+#include "stm32f4_i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Transactions that can wait per bus (power of two).
+ */
+#ifndef I2C_QUEUE_LEN
+#define I2C_QUEUE_LEN 8U
+#endif
+
+/**
+ * @brief Shortest payload moved by DMA instead of byte interrupts (at least 2).
+ */
+#ifndef I2C_DMA_MIN_LEN
+#define I2C_DMA_MIN_LEN 4U
+#endif
+
+/**
+ * @brief Transaction status.
+ */
+typedef enum {
+    I2C_STATUS_DONE      = 0,   /**< Completed */
+    I2C_STATUS_PENDING   = 1,   /**< Queued or on the bus */
+    I2C_STATUS_NACK      = -1,  /**< Address or data byte not acknowledged */
+    I2C_STATUS_BUS_ERROR = -2,  /**< Misplaced start/stop or SCL timeout; peripheral was reset */
+    I2C_STATUS_ARB_LOST  = -3   /**< Another master won arbitration; peripheral was reset */
+} i2c_status_t;
+
+struct i2c_xfer;
+
+/**
+ * @brief Completion callback, called from the I2C or DMA interrupt.
+ *
+ * May submit further transactions.
+ *
+ * @param x Finished transaction; `x->status` holds the result.
+ */
+typedef void (*i2c_callback_t)(struct i2c_xfer *x);
+
+/**
+ * @brief One transaction: [START addr+W tx…] [(RE)START addr+R rx…] STOP.
+ *
+ * With `tx_len` and `rx_len` both 0 the address alone is sent (device probe).
+ * Must stay valid, and its buffers untouched, until `status` leaves
+ * `I2C_STATUS_PENDING`.
+ */
+typedef struct i2c_xfer {
+    uint8_t addr;                  /**< 7-bit slave address */
+    const uint8_t *tx;             /**< Bytes to write, or 0 */
+    uint16_t tx_len;               /**< Bytes to write */
+    uint8_t *rx;                   /**< Buffer for read bytes, or 0 */
+    uint16_t rx_len;               /**< Bytes to read */
+    i2c_callback_t cb;             /**< Completion callback, or 0 */
+    void *ctx;                     /**< User pointer for `cb` */
+    volatile int8_t status;        /**< `i2c_status_t`, set by the driver */
+} i2c_xfer_t;
+
+/**
+ * @brief Initializes an I2C peripheral as master and enables its interrupts.
+ *
+ * Enables the clock, programs the timing from the real PCLK1 (standard mode
+ * up to 100 kHz, fast mode above) and clears the queue.
+ *
+ * @param i2c I2C1, I2C2 or I2C3.
+ * @param speed_hz SCL frequency, 10 000–400 000 Hz.
+ * @return int 0 on success, -1 on an unknown peripheral, speed or PCLK1 outside 2–50 MHz.
+ */
+int i2c_init(I2C_TypeDef *i2c, uint32_t speed_hz);
+
+/**
+ * @brief Queues a transaction; starts it at once if the bus is idle.
+ *
+ * Never waits for other transactions; at most it lets a stop condition that
+ * is still being generated finish (under one SCL period). Callable from
+ * thread and interrupt context.
+ *
+ * @param i2c I2C peripheral (initialized).
+ * @param x Transaction; `status` becomes `I2C_STATUS_PENDING`.
+ * @return int 0 if queued, -1 if the queue is full or `x` is invalid.
+ */
+int i2c_submit(I2C_TypeDef *i2c, i2c_xfer_t *x);
+
+/**
+ * @brief Reports whether a bus has queued or running transactions.
+ *
+ * @param i2c I2C peripheral.
+ * @return int 1 if busy, 0 if idle.
+ */
+int i2c_busy(I2C_TypeDef *i2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_I2C_H
@@ -0,0 +1,168 @@
+/**
+ * @file hal_nvic.h
+ * @brief NVIC (interrupt controller) interface for STM32F446RE.
+ *
+ * Provides enable/disable, priority, priority grouping and pending control for
+ * device interrupts and core exceptions, plus an option to copy the vector
+ * table into SRAM so handlers can be registered at runtime.
+ *
+ * Handlers can be installed two ways:
+ * - At link time: define `void <name>_IRQHandler(void)` (overrides the weak default in startup.s).
+ * - At runtime: `nvic_register_handler()` (relocates the vector table to SRAM on first use).
+ */
+
+#ifndef HAL_NVIC_H
+#define HAL_NVIC_H
+
+#include <stdint.h>
+#include "stm32f4_nvic.h"
+#include "stm32f4_scb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Interrupt handler function type.
+ */
+typedef void (*nvic_handler_t)(void);
+
+/**
+ * @brief Data synchronization barrier.
+ *
+ * Use after changing VTOR or an NVIC enable that must take effect before the next instruction.
+ */
+#define HAL_DSB() __asm volatile ("dsb 0xF" ::: "memory")
+
+/**
+ * @brief Instruction synchronization barrier.
+ */
+#define HAL_ISB() __asm volatile ("isb 0xF" ::: "memory")
+
+/**
+ * @brief Masks all configurable interrupts and returns the previous PRIMASK.
+ *
+ * Use with `irq_restore()` around short critical sections shared with an ISR.
+ *
+ * @return uint32_t Previous PRIMASK value.
+ */
+static inline uint32_t irq_save(void) {
+    uint32_t primask;
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask;
+}
+
+/**
+ * @brief Restores PRIMASK saved by `irq_save()`.
+ *
+ * @param primask Value returned by `irq_save()`.
+ */
+static inline void irq_restore(uint32_t primask) {
+    __asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+}
+
+/**
+ * @brief Enables a device interrupt in the NVIC.
+ *
+ * @param irqn Interrupt number (e.g., `USART2_IRQn`). Core exceptions are ignored.
+ */
+void nvic_enable_irq(IRQn_Type irqn);
+
+/**
+ * @brief Disables a device interrupt in the NVIC.
+ *
+ * @param irqn Interrupt number. Core exceptions are ignored.
+ */
+void nvic_disable_irq(IRQn_Type irqn);
+
+/**
+ * @brief Sets the priority of an interrupt or core exception.
+ *
+ * Lower values are more urgent. Only the 4 implemented bits are used, so the
+ * valid range is 0–15; how they split into preempt/sub-priority depends on
+ * `nvic_set_priority_grouping()`.
+ *
+ * @param irqn     Interrupt number (device IRQ or core exception such as `SysTick_IRQn`).
+ * @param priority Priority level 0–15.
+ */
+void nvic_set_priority(IRQn_Type irqn, uint8_t priority);
+
+/**
+ * @brief Returns the priority of an interrupt or core exception.
+ *
+ * @param irqn Interrupt number.
+ * @return uint8_t Priority level 0–15.
+ */
+uint8_t nvic_get_priority(IRQn_Type irqn);
+
+/**
+ * @brief Sets the priority grouping (AIRCR.PRIGROUP).
+ *
+ * With 4 implemented bits, PRIGROUP 3 gives 16 preemption levels and no
+ * sub-priority, PRIGROUP 7 gives no preemption and 16 sub-priorities.
+ *
+ * @param prigroup PRIGROUP value 0–7.
+ */
+void nvic_set_priority_grouping(uint8_t prigroup);
+
+/**
+ * @brief Returns the current priority grouping (AIRCR.PRIGROUP).
+ *
+ * @return uint8_t PRIGROUP value 0–7.
+ */
+uint8_t nvic_get_priority_grouping(void);
+
+/**
+ * @brief Forces a device interrupt into the pending state (software trigger).
+ *
+ * @param irqn Interrupt number.
+ */
+void nvic_set_pending(IRQn_Type irqn);
+
+/**
+ * @brief Clears the pending state of a device interrupt.
+ *
+ * @param irqn Interrupt number.
+ */
+void nvic_clear_pending(IRQn_Type irqn);
+
+/**
+ * @brief Checks whether a device interrupt is pending.
+ *
+ * @param irqn Interrupt number.
+ * @return int 1 if pending, 0 otherwise.
+ */
+int nvic_is_pending(IRQn_Type irqn);
+
+/**
+ * @brief Checks whether a device interrupt handler is currently executing (or preempted).
+ *
+ * @param irqn Interrupt number.
+ * @return int 1 if active, 0 otherwise.
+ */
+int nvic_is_active(IRQn_Type irqn);
+
+/**
+ * @brief Copies the flash vector table into SRAM and points VTOR at the copy.
+ *
+ * Safe to call more than once; only the first call copies. Interrupts are
+ * masked during the switch.
+ */
+void nvic_relocate_vectors(void);
+
+/**
+ * @brief Installs a handler for an interrupt or core exception at runtime.
+ *
+ * Relocates the vector table to SRAM first if needed.
+ *
+ * @param irqn    Interrupt number (device IRQ or core exception).
+ * @param handler Function to call when the interrupt fires.
+ * @return int 0 on success, -1 if `irqn` is outside the vector table.
+ */
+int nvic_register_handler(IRQn_Type irqn, nvic_handler_t handler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_NVIC_H
@@ -0,0 +1,120 @@
+/**
+ * @file hal_periph.h
+ * @brief Constant-time peripheral descriptor lookup for STM32F446RE.
+ *
+ * One const descriptor per peripheral instance records where its clock
+ * enable and reset bits live, which clock it runs from, its main interrupt
+ * line, its default DMA requests and its row in the owning driver's state
+ * arrays. `periph_lookup()` finds the descriptor from the base address with
+ * one table index; the drivers take their instance index, interrupt line and
+ * DMA streams from it instead of keeping their own comparison chains and
+ * per-driver IRQ/DMA tables.
+ *
+ * The index is built from the address bits that tell peripherals apart:
+ * bus (APB1 0x4000xxxx, APB2 0x4001xxxx, AHB1 0x4002xxxx) and the 256-byte
+ * block inside the first 32 KB of that bus.
+ *
+ * @code
+ * const periph_desc_t *d = periph_lookup(USART2);
+ * // d->bus == RCC_BUS_APB1, d->en_bit == 17, d->irqn == USART2_IRQn,
+ * // d->dma_tx == { DMA1, 6, 4 }, d->kind == PERIPH_KIND_UART, d->unit == 1
+ * @endcode
+ */
+
+#ifndef HAL_PERIPH_H
+#define HAL_PERIPH_H
+
+#include <stdint.h>
+#include "stm32f4_dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Bus of a peripheral, as the word offset of its RCC enable/reset register.
+ *
+ * `&RCC->AHB1ENR + bus` is the enable register, `&RCC->AHB1RSTR + bus` the
+ * reset register (the RCC keeps both groups in the same order).
+ */
+typedef enum {
+    RCC_BUS_AHB1 = 0,   /**< AHB1ENR / AHB1RSTR */
+    RCC_BUS_AHB2 = 1,   /**< AHB2ENR / AHB2RSTR */
+    RCC_BUS_AHB3 = 2,   /**< AHB3ENR / AHB3RSTR */
+    RCC_BUS_APB1 = 4,   /**< APB1ENR / APB1RSTR */
+    RCC_BUS_APB2 = 5    /**< APB2ENR / APB2RSTR */
+} rcc_bus_t;
+
+/**
+ * @brief Clock a peripheral's registers and counters run from.
+ */
+typedef enum {
+    RCC_CLK_HCLK     = 0,   /**< AHB clock */
+    RCC_CLK_PCLK1    = 1,   /**< APB1 clock */
+    RCC_CLK_PCLK2    = 2,   /**< APB2 clock */
+    RCC_CLK_APB1_TIM = 3,   /**< APB1 timer clock (PCLK1 × 2 when APB1 is divided) */
+    RCC_CLK_APB2_TIM = 4    /**< APB2 timer clock (PCLK2 × 2 when APB2 is divided) */
+} rcc_clk_t;
+
+/**
+ * @brief Peripheral type, used by drivers to reject instances of another type.
+ */
+typedef enum {
+    PERIPH_KIND_GPIO = 0,   /**< GPIOA–GPIOH */
+    PERIPH_KIND_DMA,        /**< DMA1, DMA2 */
+    PERIPH_KIND_TIM,        /**< TIM1–TIM14 */
+    PERIPH_KIND_UART,       /**< USART1–3, UART4–5, USART6 */
+    PERIPH_KIND_SPI,        /**< SPI1–SPI4 */
+    PERIPH_KIND_I2C,        /**< I2C1–I2C3 */
+    PERIPH_KIND_ADC,        /**< ADC1–ADC3 */
+    PERIPH_KIND_DAC,        /**< DAC */
+    PERIPH_KIND_SYS         /**< SYSCFG, PWR */
+} periph_kind_t;
+
+/**
+ * @brief Peripheral instance descriptor.
+ *
+ * DMA requests hold the mapping the drivers use; `dma == 0` means none.
+ * Timers list their update request as `dma_tx`, the DAC its OUT1 request.
+ * I2C descriptors hold the event interrupt; the error interrupt is `irqn + 1`.
+ *
+ * `unit` is the instance's row in its driver's state arrays: USART1, USART2,
+ * USART3, UART4, UART5, USART6 = 0–5; SPIn, I2Cn, ADCn = n − 1; timers
+ * TIM1–TIM5 = 0–4, TIM8 = 5 (the rows with capture/compare DMA), TIM6/TIM7
+ * = 6/7, TIM9–TIM14 = 8–13.
+ */
+typedef struct {
+    uint32_t base;            /**< Base address */
+    uint8_t bus;              /**< `rcc_bus_t` */
+    uint8_t en_bit;           /**< Bit in the bus enable register */
+    uint8_t rst_bit;          /**< Bit in the bus reset register (ADC1–3 share one) */
+    uint8_t clk;              /**< `rcc_clk_t` */
+    uint8_t kind;             /**< `periph_kind_t` */
+    uint8_t unit;             /**< Index within the driver of that kind */
+    int8_t irqn;              /**< Main interrupt line, -1 if none */
+    dma_request_t dma_rx;     /**< Peripheral-to-memory request */
+    dma_request_t dma_tx;     /**< Memory-to-peripheral request */
+} periph_desc_t;
+
+/**
+ * @brief Finds the descriptor of a peripheral instance in O(1).
+ *
+ * @param periph Peripheral base pointer (e.g. `USART2`, `TIM1`, `GPIOA`).
+ * @return const periph_desc_t* Descriptor, or 0 if `periph` is not a known base address.
+ */
+const periph_desc_t *periph_lookup(const volatile void *periph);
+
+/**
+ * @brief Returns a peripheral's row in its driver's state arrays, checking its type.
+ *
+ * @param periph Peripheral base pointer.
+ * @param kind Type the caller expects.
+ * @return int `unit` of the descriptor, or -1 if unknown or of another type.
+ */
+int periph_index(const volatile void *periph, periph_kind_t kind);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_PERIPH_H
@@ -0,0 +1,153 @@
+/**
+ * @file hal_profile.h
+ * @brief Cycle-accurate code profiling on the DWT cycle counter for STM32F446RE.
+ *
+ * Regions are identified by a small integer id (0 to `PROFILE_MAX_REGIONS - 1`),
+ * typically an application enum. Each `PROFILE_BEGIN(id)` / `PROFILE_END(id)`
+ * pair records the elapsed core cycles into a static table holding count,
+ * min, max and total, from which the mean is derived. The measured overhead of
+ * an empty region is subtracted, so results are the cost of the code in between.
+ *
+ * `PROFILE_BEGIN` and `PROFILE_END` must appear in the same scope; the begin
+ * timestamp is a local variable. Both are safe in ISRs. Building with
+ * `-DHAL_PROFILE_ENABLE=0` compiles them away.
+ *
+ * @code
+ * enum { PROF_SPI, PROF_ISR };
+ *
+ * profile_init();
+ * profile_set_name(PROF_SPI, "spi_transfer");
+ *
+ * PROFILE_BEGIN(PROF_SPI);
+ * spi_transfer(SPI1, 0xA5);
+ * PROFILE_END(PROF_SPI);
+ *
+ * profile_dump(USART2);
+ * @endcode
+ */
+
+#ifndef HAL_PROFILE_H
+#define HAL_PROFILE_H
+
+#include <stdint.h>
+#include "stm32f4_dwt.h"
+#include "stm32f4_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of profiling regions in the statistics table.
+ */
+#ifndef PROFILE_MAX_REGIONS
+#define PROFILE_MAX_REGIONS 16U
+#endif
+
+/**
+ * @brief Set to 0 to compile out `PROFILE_BEGIN` / `PROFILE_END`.
+ */
+#ifndef HAL_PROFILE_ENABLE
+#define HAL_PROFILE_ENABLE 1
+#endif
+
+/**
+ * @brief Accumulated statistics of one region.
+ */
+typedef struct {
+    const char *name;   /**< Label printed by `profile_dump()`, or 0 */
+    uint32_t count;     /**< Number of completed measurements */
+    uint32_t min;       /**< Shortest measurement in cycles */
+    uint32_t max;       /**< Longest measurement in cycles */
+    uint64_t total;     /**< Sum of all measurements in cycles */
+} profile_region_t;
+
+/**
+ * @brief Reads the free-running core cycle counter.
+ *
+ * Wraps every 2^32 cycles (about 23.8 s at 180 MHz); differences of two reads
+ * are correct across one wrap.
+ *
+ * @return uint32_t Current CYCCNT value.
+ */
+static inline uint32_t profile_cycles(void) {
+    return DWT->CYCCNT;
+}
+
+#if HAL_PROFILE_ENABLE
+/**
+ * @brief Starts timing region `id` (declares a local timestamp).
+ */
+#define PROFILE_BEGIN(id) uint32_t profile_t0_##id = profile_cycles()
+
+/**
+ * @brief Stops timing region `id` and records the elapsed cycles.
+ */
+#define PROFILE_END(id)   profile_record((id), profile_cycles() - profile_t0_##id)
+#else
+#define PROFILE_BEGIN(id) ((void)0)
+#define PROFILE_END(id)   ((void)0)
+#endif
+
+/**
+ * @brief Enables the DWT cycle counter, clears the table and calibrates overhead.
+ *
+ * Must be called before the first `PROFILE_BEGIN`.
+ */
+void profile_init(void);
+
+/**
+ * @brief Clears the statistics of all regions (names are kept).
+ */
+void profile_reset(void);
+
+/**
+ * @brief Assigns a label to a region for `profile_dump()`.
+ *
+ * @param id   Region id.
+ * @param name Label (must stay valid, e.g. a string literal).
+ */
+void profile_set_name(uint8_t id, const char *name);
+
+/**
+ * @brief Adds one measurement to a region.
+ *
+ * Used by `PROFILE_END`; can also be called directly with cycles measured by
+ * other means. The calibrated begin/end overhead is subtracted.
+ *
+ * @param id     Region id; out-of-range ids are ignored.
+ * @param cycles Raw elapsed cycles.
+ */
+void profile_record(uint8_t id, uint32_t cycles);
+
+/**
+ * @brief Returns the statistics of a region.
+ *
+ * @param id Region id.
+ * @return const profile_region_t* Region entry, or 0 if `id` is out of range.
+ */
+const profile_region_t *profile_get(uint8_t id);
+
+/**
+ * @brief Returns the mean cycles of a region.
+ *
+ * @param id Region id.
+ * @return uint32_t Mean in cycles, 0 if the region has no measurements.
+ */
+uint32_t profile_mean(uint8_t id);
+
+/**
+ * @brief Prints every region with at least one measurement as a table.
+ *
+ * One line per region: id, count, min, mean, max (cycles), name. Output goes
+ * through `uart_print()`, so the UART must already be initialized.
+ *
+ * @param uart UART to print to (e.g., `USART2`).
+ */
+void profile_dump(UART_TypeDef *uart);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_PROFILE_H
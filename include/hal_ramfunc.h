@@ -0,0 +1,42 @@
+/**
+ * @file hal_ramfunc.h
+ * @brief Placement attributes for code and data that must run from SRAM.
+ *
+ * Functions marked `HAL_RAMFUNC` are linked into the `.ramfunc` output section:
+ * stored in flash, copied to SRAM by `Reset_Handler` together with `.data`,
+ * and executed from SRAM with no flash wait states or ART cache misses. This
+ * gives cycle-exact timing for ISR bodies and tight loops regardless of the
+ * flash latency set by `rcc_clock_config()`.
+ *
+ * Constant lookup tables read from such code can be placed next to it with
+ * `HAL_RAMDATA` (the table is then writable in SRAM; keep it `const` in C).
+ * To run the vector table from SRAM as well, call `nvic_relocate_vectors()`.
+ *
+ * @code
+ * HAL_RAMDATA static const uint8_t gamma[256] = { ... };
+ *
+ * HAL_RAMFUNC void TIM2_IRQHandler(void) {
+ *     TIM2->SR = 0;
+ *     TIM2->CCR1 = gamma[level++];
+ * }
+ * @endcode
+ */
+
+#ifndef HAL_RAMFUNC_H
+#define HAL_RAMFUNC_H
+
+/**
+ * @brief Places a function in SRAM.
+ *
+ * `long_call` makes callers in flash use a register-indirect branch, since SRAM
+ * (0x20000000) is out of `bl` range from flash (0x08000000). `noinline` keeps
+ * the body from being inlined back into flash callers.
+ */
+#define HAL_RAMFUNC __attribute__((section(".ramfunc"), long_call, noinline))
+
+/**
+ * @brief Places a variable or constant table in the SRAM-resident `.ramfunc` section.
+ */
+#define HAL_RAMDATA __attribute__((section(".ramdata")))
+
+#endif // HAL_RAMFUNC_H
@@ -5,6 +5,20 @@
  * This header provides simplified clock enabling functions for peripherals
  * like GPIO, UART, SPI, and TIM using direct register access. Works in 
  * conjunction with `stm32f4_rcc.h` register definitions.
+ *
+ * Any peripheral listed in the descriptor table (`hal_periph.h`) can also be
+ * enabled, reset or asked for its clock by base pointer alone, and a whole
+ * set can be enabled with one write per bus register:
+ *
+ * @code
+ * static const volatile void *const clocks[] = { GPIOA, USART2, TIM2, DMA1 };
+ * rcc_enable_many(clocks, 4);            // one AHB1ENR and one APB1ENR write
+ * uart_init(USART2, UART_BAUD_115200);   // BRR from rcc_get_pclk(USART2)
+ * @endcode
+ *
+ * It also configures the clock tree (HSI/HSE, PLL up to 180 MHz, flash wait
+ * states, ART accelerator, over-drive, bus prescalers) and reports the
+ * resulting SYSCLK/HCLK/PCLK/timer clock frequencies.
  */
 
 
@@ -15,6 +29,15 @@
 #include "hal_spi.h"
 #include "hal_tim.h"
 #include "hal_uart.h"
+#include "hal_dma.h"
+#include "stm32f4_adc.h"
+#include "stm32f4_dac.h"
+#include "stm32f4_i2c.h"
+#include "hal_periph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 
 /**
@@ -28,6 +51,33 @@
  */
 void rcc_enable(volatile uint32_t *reg, uint8_t bit_pos);
 
+/**
+ * @brief Enables the clock of a peripheral found by its base pointer.
+ *
+ * @param periph Peripheral base pointer (e.g. `USART2`, `TIM1`, `DMA2`, `GPIOC`).
+ * @return int 0 on success, -1 if `periph` is not in the descriptor table.
+ */
+int rcc_enable_periph(const volatile void *periph);
+
+/**
+ * @brief Resets a peripheral through its RCC reset bit.
+ *
+ * ADC1–3 share a single reset bit.
+ *
+ * @param periph Peripheral base pointer.
+ * @return int 0 on success, -1 if `periph` is not in the descriptor table.
+ */
+int rcc_reset_periph(const volatile void *periph);
+
+/**
+ * @brief Enables the clocks of several peripherals, one register write per bus.
+ *
+ * @param periphs Array of peripheral base pointers.
+ * @param n Number of entries.
+ * @return int 0 on success, -1 if any entry is unknown (nothing is enabled then).
+ */
+int rcc_enable_many(const volatile void *const *periphs, uint8_t n);
+
 /**
  * @brief Enables the peripheral clock for a specific TIM instance.
  *
@@ -48,6 +98,13 @@ void rcc_enable_tim(TIM_TypeDef *timx);
  */
 void rcc_enable_gpio(uint16_t port_index);
 
+/**
+ * @brief Enables the clocks of several GPIO ports with one register write.
+ *
+ * @param port_mask Bit n set enables port n (bit 0 = GPIOA ... bit 7 = GPIOH).
+ */
+void rcc_enable_gpio_mask(uint8_t port_mask);
+
 /**
  * @brief Enables the peripheral clock for a UART/USART peripheral.
  *
@@ -66,4 +123,136 @@ void rcc_enable_uart(UART_TypeDef *uart);
  * @param spix Pointer to SPI peripheral (e.g., `SPI1`, `SPI2`).
  */
 void rcc_enable_spi(SPI_TypeDef * spix);
-#endif //HAL_RCC_H
\ No newline at end of file
+
+/**
+ * @brief Enables the peripheral clock for a DMA controller.
+ *
+ * Sets DMA1EN or DMA2EN in `RCC->AHB1ENR`.
+ *
+ * @param dma Pointer to DMA controller (`DMA1` or `DMA2`).
+ */
+void rcc_enable_dma(DMA_TypeDef *dma);
+
+/**
+ * @brief Enables the clock for an ADC (ADCxEN in `RCC->APB2ENR`).
+ *
+ * @param adc Pointer to ADC peripheral (ADC1, ADC2 or ADC3).
+ */
+void rcc_enable_adc(ADC_TypeDef *adc);
+
+/**
+ * @brief Enables the DAC clock (DACEN in `RCC->APB1ENR`).
+ */
+void rcc_enable_dac(void);
+
+/**
+ * @brief Enables the clock for an I2C peripheral (I2CxEN in `RCC->APB1ENR`).
+ *
+ * @param i2c Pointer to I2C peripheral (I2C1, I2C2 or I2C3).
+ */
+void rcc_enable_i2c(I2C_TypeDef *i2c);
+
+/**
+ * @brief Enables the SYSCFG clock (SYSCFGEN in `RCC->APB2ENR`).
+ *
+ * Needed before writing `SYSCFG->EXTICR` to route GPIO pins to EXTI lines.
+ */
+void rcc_enable_syscfg(void);
+
+/**
+ * @brief Configures the clock tree and switches SYSCLK to the requested frequency.
+ *
+ * Starts the selected oscillator, solves PLL M/N/P for an exact `sysclk_hz`
+ * (VCO input 1–2 MHz, VCO output 100–432 MHz), selects the regulator scale
+ * and over-drive (above 168 MHz), programs flash wait states with prefetch and
+ * instruction/data caches, sets the AHB/APB prescalers and finally updates
+ * `SystemCoreClock`.
+ *
+ * If `sysclk_hz` equals the oscillator frequency, the PLL is bypassed.
+ *
+ * @param cfg Clock configuration.
+ * @return int 0 on success, -1 if the frequency can't be reached exactly or the
+ *             HSE/PLL/over-drive failed to start (the clock is left on HSI).
+ *
+ * @code
+ * rcc_clock_config_t clk = {
+ *     .source = RCC_SRC_HSE, .hse_hz = 8000000, .hse_bypass = 1,   // Nucleo ST-Link MCO
+ *     .sysclk_hz = 180000000,
+ * };
+ * rcc_clock_config(&clk);            // HCLK 180 MHz, APB1 45 MHz, APB2 90 MHz
+ * @endcode
+ */
+int rcc_clock_config(const rcc_clock_config_t *cfg);
+
+/**
+ * @brief Recomputes `SystemCoreClock` (HCLK) from the RCC registers.
+ *
+ * Called by `rcc_clock_config()`; call it yourself only if the clock tree was
+ * changed by other code.
+ */
+void rcc_update_system_core_clock(void);
+
+/**
+ * @brief Returns the SYSCLK frequency in Hz, read back from the RCC registers.
+ *
+ * @return uint32_t SYSCLK in Hz.
+ */
+uint32_t rcc_get_sysclk_hz(void);
+
+/**
+ * @brief Returns the AHB clock (HCLK, core clock) in Hz.
+ *
+ * @return uint32_t HCLK in Hz (same as `SystemCoreClock`).
+ */
+uint32_t rcc_get_hclk_hz(void);
+
+/**
+ * @brief Returns the APB1 peripheral clock (PCLK1) in Hz.
+ *
+ * Derived from HCLK and the APB1 prescaler in `RCC->CFGR`.
+ *
+ * @return uint32_t PCLK1 frequency in Hz.
+ */
+uint32_t rcc_get_pclk1_hz(void);
+
+/**
+ * @brief Returns the APB2 peripheral clock (PCLK2) in Hz.
+ *
+ * Derived from HCLK and the APB2 prescaler in `RCC->CFGR`.
+ *
+ * @return uint32_t PCLK2 frequency in Hz.
+ */
+uint32_t rcc_get_pclk2_hz(void);
+
+/**
+ * @brief Returns the clock of timers on APB1 (TIM2–7, TIM12–14) in Hz.
+ *
+ * Twice PCLK1 whenever the APB1 divider is not 1 (or per DCKCFGR.TIMPRE).
+ *
+ * @return uint32_t APB1 timer clock in Hz.
+ */
+uint32_t rcc_get_apb1_timclk_hz(void);
+
+/**
+ * @brief Returns the clock of timers on APB2 (TIM1, TIM8–11) in Hz.
+ *
+ * @return uint32_t APB2 timer clock in Hz.
+ */
+uint32_t rcc_get_apb2_timclk_hz(void);
+
+/**
+ * @brief Returns the clock a peripheral is fed from, read back from the RCC registers.
+ *
+ * HCLK for AHB peripherals, PCLK1/PCLK2 for APB peripherals, and the APB timer
+ * clock for timers.
+ *
+ * @param periph Peripheral base pointer.
+ * @return uint32_t Clock in Hz, or 0 if `periph` is not in the descriptor table.
+ */
+uint32_t rcc_get_pclk(const volatile void *periph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //HAL_RCC_H
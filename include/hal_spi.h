@@ -5,6 +5,17 @@
  * This header provides user-facing functions for initializing SPI peripherals
  * and transmitting/receiving data over SPI. It uses direct register access,
  * and is intended to be lightweight and beginner-friendly.
+ *
+ * `spi_init_config()` sets mode, frame size, bit order and picks the fastest
+ * baud prescaler that does not exceed the requested SCK frequency.
+ *
+ * Block transfers (`spi_transfer_buf()` and friends) run on a paired RX/TX
+ * DMA stream and return immediately; completion is signalled by callback or
+ * by polling `spi_busy()`. `spi_transfer_burst()` is the polled equivalent
+ * that keeps the TX buffer full so frames go out back-to-back.
+ *
+ * Buffer element size follows the configured frame size: `uint8_t` for 8-bit
+ * frames, `uint16_t` for 16-bit frames, and lengths are counted in frames.
  */
 
 #ifndef HAL_SPI_H
@@ -13,6 +24,28 @@
 #include <stdint.h>
 #include "stm32f4_spi.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Byte clocked out when a block transfer has no TX buffer (read-only transfers).
+ *
+ * With 16-bit frames, the byte is sent in both halves of the frame.
+ */
+#ifndef SPI_DUMMY_BYTE
+#define SPI_DUMMY_BYTE 0xFFU
+#endif
+
+/**
+ * @brief Block transfer completion callback type.
+ *
+ * Called from the RX DMA interrupt once the last byte has been received.
+ *
+ * @param spix SPI peripheral whose transfer finished.
+ */
+typedef void (*spi_callback_t)(SPI_TypeDef *spix);
+
 /**
  * @brief Sends and receives one byte over SPI.
  *
@@ -27,6 +60,34 @@
  */
 uint8_t spi_transfer(SPI_TypeDef *spix, uint8_t data);
 
+/**
+ * @brief Sends and receives one 16-bit frame over SPI.
+ *
+ * Same as `spi_transfer()` for ports configured with `SPI_FRAME_16BIT`.
+ *
+ * @param spix Pointer to the SPI peripheral.
+ * @param data The frame to transmit.
+ * @return uint16_t The frame received during transmission.
+ */
+uint16_t spi_transfer16(SPI_TypeDef *spix, uint16_t data);
+
+/**
+ * @brief Polled multi-frame transfer with no gap between frames.
+ *
+ * Writes the next frame as soon as TXE is set, before reading the previous
+ * frame's response, so the shift register never idles between frames.
+ * Either buffer may be 0 (dummy frames are sent / responses are discarded).
+ *
+ * @param spix  Pointer to the SPI peripheral.
+ * @param tx    Frames to send (`uint8_t` or `uint16_t` per frame size), or 0.
+ * @param rx    Buffer for received frames, or 0.
+ * @param count Number of frames.
+ *
+ * @note Blocks until the last frame has completed (BSY = 0). Long interrupts
+ *       during the burst can cause an overrun, use the DMA variant for those.
+ */
+void spi_transfer_burst(SPI_TypeDef *spix, const void *tx, void *rx, uint32_t count);
+
 /**
  * @brief Initializes the given SPI peripheral in master mode.
  *
@@ -44,4 +105,77 @@ uint8_t spi_transfer(SPI_TypeDef *spix, uint8_t data);
  */
 void spi_init(SPI_TypeDef *spix);
 
+/**
+ * @brief Initializes the SPI peripheral in master mode from a configuration.
+ *
+ * Uses the real APB clock of the port (APB2 for SPI1/SPI4, APB1 for SPI2/SPI3)
+ * and selects the smallest divider (2–256) whose SCK does not exceed `cfg->max_hz`.
+ * Software NSS management is enabled, as in `spi_init()`.
+ *
+ * @param spix Pointer to the SPI peripheral.
+ * @param cfg  Mode, frame size, bit order and maximum SCK frequency.
+ * @return uint32_t Actual SCK frequency in Hz.
+ *
+ * @note If even the /256 divider is too fast, /256 is used.
+ */
+uint32_t spi_init_config(SPI_TypeDef *spix, const spi_config_t *cfg);
+
+/**
+ * @brief Starts a full-duplex block transfer using DMA.
+ *
+ * Sends `len` frames from `tx` while storing the `len` received frames into `rx`.
+ * Either buffer may be 0:
+ * - `tx == 0`: receive-only, `SPI_DUMMY_BYTE` is clocked out for every frame.
+ * - `rx == 0`: transmit-only, received frames are discarded.
+ *
+ * @param spix Pointer to SPI peripheral (`SPI1`–`SPI4`).
+ * @param tx   Frames to send, or 0.
+ * @param rx   Buffer for received frames, or 0.
+ * @param len  Number of frames (1–65535).
+ * @param cb   Completion callback (interrupt context), or 0 to poll with `spi_busy()`.
+ * @return int 0 if the transfer was started, -1 if the port is busy or invalid.
+ *
+ * @note Buffers must stay valid until completion. Chip select is the caller's job.
+ */
+int spi_transfer_buf(SPI_TypeDef *spix, const void *tx, void *rx,
+                     uint16_t len, spi_callback_t cb);
+
+/**
+ * @brief Starts a transmit-only block transfer using DMA.
+ *
+ * Same as `spi_transfer_buf(spix, tx, 0, len, cb)`.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param tx   Frames to send.
+ * @param len  Number of frames.
+ * @param cb   Completion callback, or 0.
+ * @return int 0 if started, -1 if busy or invalid.
+ */
+int spi_write_buf(SPI_TypeDef *spix, const void *tx, uint16_t len, spi_callback_t cb);
+
+/**
+ * @brief Starts a receive-only block transfer using DMA (clocks out `SPI_DUMMY_BYTE`).
+ *
+ * Same as `spi_transfer_buf(spix, 0, rx, len, cb)`.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param rx   Buffer for received frames.
+ * @param len  Number of frames.
+ * @param cb   Completion callback, or 0.
+ * @return int 0 if started, -1 if busy or invalid.
+ */
+int spi_read_buf(SPI_TypeDef *spix, void *rx, uint16_t len, spi_callback_t cb);
+
+/**
+ * @brief Checks whether a DMA block transfer is still running.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @return int 1 while a transfer is in progress, 0 when idle.
+ */
+int spi_busy(SPI_TypeDef *spix);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif // HAL_SPI_H
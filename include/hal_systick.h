@@ -2,9 +2,11 @@
  * @file hal_systick.h
  * @brief High-level SysTick interface for STM32F411RE.
  *
- * Provides basic delay functions and initialization routines using
- * the Cortex-M4 SysTick timer. Designed for precise microsecond
- * and millisecond delays in bare-metal applications.
+ * Runs SysTick as the system time base: a 1 kHz interrupt maintains a 64-bit
+ * tick counter, and `hal_millis()` / `hal_micros()` combine it with the
+ * current counter value for sub-millisecond resolution. Deadlines
+ * (`hal_deadline_t`) allow polling for timeouts without blocking, and the
+ * blocking `delay_us()` / `delay_ms()` run on top of the same running tick.
  */
 
 #ifndef HAL_SYSTICK_H
@@ -13,11 +15,41 @@
 #include <stdint.h>
 #include "stm32f4_systick.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief SysTick interrupt rate in Hz (one tick per millisecond).
+ */
+#define HAL_TICK_HZ 1000U
+
+/**
+ * @brief Core clock frequency in Hz, used by delay and bus clock calculations.
+ */
+extern uint32_t SystemCoreClock;
+
+/**
+ * @brief Point in time for non-blocking timeouts.
+ *
+ * @code
+ * hal_deadline_t d;
+ * hal_deadline_set_ms(&d, 50);
+ * while (!(SPI1->SR & SPI_SR_RXNE)) {
+ *     if (hal_deadline_expired(&d)) return -1;
+ * }
+ * @endcode
+ */
+typedef struct {
+    uint64_t expires_us;   /**< Absolute expiry time in `hal_micros()` units */
+} hal_deadline_t;
+
 /**
  * @brief Delays execution for a specified number of microseconds.
  *
- * This function uses the SysTick timer to block the CPU for an accurate
- * delay in microseconds. Assumes SysTick has been configured for 1µs ticks.
+ * Counts elapsed core cycles on the running SysTick counter, so any length is
+ * handled across reloads and the tick interrupt keeps running. Starts the
+ * tick with `hal_tick_init()` if it isn't running yet.
  *
  * @param us Number of microseconds to delay.
  *
@@ -28,7 +60,7 @@ void delay_us(uint32_t us);
 /**
  * @brief Delays execution for a specified number of milliseconds.
  *
- * Uses `delay_us()` internally to create a millisecond-scale blocking delay.
+ * Waits on `hal_micros()`, so the tick keeps counting during the delay.
  *
  * @param ms Number of milliseconds to delay.
  *
@@ -39,8 +71,9 @@ void delay_ms(uint32_t ms);
 /**
  * @brief Initializes the SysTick timer with a specific tick interval.
  *
- * This function configures the SysTick LOAD register to define how often
- * the timer will roll over. Typically used for creating fixed timebases.
+ * Programs LOAD, clears the counter and enables it on the processor clock with
+ * the tick interrupt. The time functions assume a 1 ms interval; prefer
+ * `hal_tick_init()`.
  *
  * @param ticks Number of core clock cycles between timer rollovers.
  *
@@ -48,11 +81,77 @@ void delay_ms(uint32_t ms);
  */
 void systick_init(uint32_t ticks);
 
+/**
+ * @brief Starts the 1 kHz system tick from `SystemCoreClock`.
+ *
+ * Gives SysTick the lowest interrupt priority. Safe to call again; the tick
+ * count is preserved.
+ */
+void hal_tick_init(void);
+
+/**
+ * @brief Returns the number of tick interrupts since `hal_tick_init()`.
+ *
+ * @return uint64_t Tick count (milliseconds).
+ */
+uint64_t hal_ticks(void);
+
+/**
+ * @brief Returns milliseconds since the tick was started.
+ *
+ * @return uint32_t Milliseconds (wraps after ~49.7 days; use `hal_ticks()` for 64-bit).
+ */
+uint32_t hal_millis(void);
+
+/**
+ * @brief Returns microseconds since the tick was started.
+ *
+ * Combines the tick count with `SysTick->VAL`. Correct when called with
+ * interrupts masked or from a higher-priority ISR: a reload whose tick
+ * interrupt is still pending is accounted for.
+ *
+ * @return uint64_t Microseconds (does not wrap in practice).
+ */
+uint64_t hal_micros(void);
+
+/**
+ * @brief Arms a deadline `timeout_us` microseconds from now.
+ *
+ * @param d Deadline to set.
+ * @param timeout_us Timeout in microseconds.
+ */
+void hal_deadline_set_us(hal_deadline_t *d, uint32_t timeout_us);
+
+/**
+ * @brief Arms a deadline `timeout_ms` milliseconds from now.
+ *
+ * @param d Deadline to set.
+ * @param timeout_ms Timeout in milliseconds.
+ */
+void hal_deadline_set_ms(hal_deadline_t *d, uint32_t timeout_ms);
+
+/**
+ * @brief Checks whether a deadline has passed.
+ *
+ * @param d Deadline.
+ * @return int 1 if expired, 0 otherwise.
+ */
+int hal_deadline_expired(const hal_deadline_t *d);
+
+/**
+ * @brief Returns the time left before a deadline.
+ *
+ * @param d Deadline.
+ * @return uint32_t Remaining microseconds (saturated), 0 if expired.
+ */
+uint32_t hal_deadline_remaining_us(const hal_deadline_t *d);
+
 /**
  * @brief Updates the system core clock frequency.
  *
  * Updates the global variable `SystemCoreClock` so delay functions
  * and tick calculations stay accurate after PLL changes or clock reconfiguration.
+ * If the tick is running, its reload value is reprogrammed for the new clock.
  *
  * @param new_freq New system clock frequency in Hz (e.g., 16000000 for 16 MHz).
  *
@@ -61,4 +160,8 @@ void systick_init(uint32_t ticks);
  */
 void system_core_clock_update(uint32_t new_freq);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // HAL_SYSTICK_H
@@ -0,0 +1,133 @@
+/**
+ * @file hal_task.h
+ * @brief Fixed-rate periodic task dispatcher on the TIM6/TIM7 basic timers.
+ *
+ * Runs a static table of (callback, rate) tasks from timer update
+ * interrupts, rate-monotonic style: the tasks with the highest rate form the
+ * fast group on TIM6, all others the slow group on TIM7 at a lower NVIC
+ * priority, so the fast loop preempts the slow one. Within a group each task
+ * runs every `group rate / task rate` ticks, so its rate must divide the
+ * group rate. PSC/ARR are solved exactly for the real timer clock
+ * (`tim_set_rate()`); a rate that can't be produced exactly is rejected.
+ *
+ * Statistics, all from the DWT cycle counter and the timer counter:
+ * - per task: runs, min/max/last/total execution cycles, overruns
+ *   (execution longer than the task's own period)
+ * - per group: ticks, overruns (next tick pending when the group finished),
+ *   entry latency min/max in timer ticks; max - min is the release jitter
+ *
+ * Tasks run in interrupt context and must not block.
+ *
+ * @code
+ * static void current_loop(void *ctx) { ... }   // 10 kHz
+ * static void speed_loop(void *ctx)   { ... }   // 1 kHz
+ * static void telemetry(void *ctx)    { ... }   // 100 Hz
+ *
+ * static hal_task_t tasks[] = {
+ *     { current_loop, 0, 10000 },
+ *     { speed_loop,   0, 1000 },
+ *     { telemetry,    0, 100 },
+ * };
+ *
+ * hal_task_start(tasks, 3);     // TIM6: 10 kHz group; TIM7: 1 kHz group (telemetry every 10th tick)
+ * @endcode
+ */
+
+#ifndef HAL_TASK_H
+#define HAL_TASK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief NVIC priority of the fast group (TIM6). Lower number = more urgent.
+ */
+#ifndef HAL_TASK_FAST_PRIORITY
+#define HAL_TASK_FAST_PRIORITY 2U
+#endif
+
+/**
+ * @brief NVIC priority of the slow group (TIM7).
+ */
+#ifndef HAL_TASK_SLOW_PRIORITY
+#define HAL_TASK_SLOW_PRIORITY 3U
+#endif
+
+/**
+ * @brief Task entry point.
+ *
+ * @param ctx User pointer from the task entry.
+ */
+typedef void (*hal_task_fn_t)(void *ctx);
+
+/**
+ * @brief One periodic task. Fill the first three fields; the rest is managed
+ *        by the dispatcher and holds the task's statistics.
+ */
+typedef struct {
+    hal_task_fn_t fn;        /**< Entry point */
+    void *ctx;               /**< User pointer passed to `fn` */
+    uint32_t rate_hz;        /**< Run rate in Hz */
+
+    uint8_t group;           /**< 0 = fast (TIM6), 1 = slow (TIM7) */
+    uint32_t divider;        /**< Group ticks per run */
+    uint32_t countdown;      /**< Group ticks until the next run */
+    uint32_t period_cycles;  /**< Task period in core cycles */
+    uint32_t runs;           /**< Completed runs */
+    uint32_t overruns;       /**< Runs that took longer than the period */
+    uint32_t exec_last;      /**< Cycles of the last run */
+    uint32_t exec_min;       /**< Shortest run in cycles */
+    uint32_t exec_max;       /**< Longest run in cycles */
+    uint64_t exec_total;     /**< Sum of all runs in cycles */
+} hal_task_t;
+
+/**
+ * @brief Statistics of one task group (one timer).
+ */
+typedef struct {
+    uint32_t rate_hz;        /**< Tick rate of the group, 0 if unused */
+    uint32_t tick_hz;        /**< Timer counter rate, for converting latencies */
+    uint32_t ticks;          /**< Ticks served */
+    uint32_t overruns;       /**< Ticks that ended with the next one already pending */
+    uint32_t latency_min;    /**< Smallest CNT seen at entry (timer ticks after the update) */
+    uint32_t latency_max;    /**< Largest CNT seen at entry */
+} hal_task_group_t;
+
+/**
+ * @brief Assigns tasks to groups, programs TIM6/TIM7 and starts dispatching.
+ *
+ * Enables the DWT cycle counter. `tasks` must stay valid while running.
+ *
+ * @param tasks Task table.
+ * @param count Number of tasks.
+ * @return int 0 on success, -1 if a rate is 0, does not divide its group
+ *         rate, or cannot be generated exactly.
+ */
+int hal_task_start(hal_task_t *tasks, uint8_t count);
+
+/**
+ * @brief Stops both timers and detaches their interrupts.
+ */
+void hal_task_stop(void);
+
+/**
+ * @brief Returns the statistics of a group.
+ *
+ * @param group 0 = fast (TIM6), 1 = slow (TIM7).
+ * @return const hal_task_group_t* Group statistics, or 0 if `group` is invalid.
+ */
+const hal_task_group_t *hal_task_group_stats(uint8_t group);
+
+/**
+ * @brief Clears the task and group statistics (keeps the schedule running).
+ */
+void hal_task_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_TASK_H
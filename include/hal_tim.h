@@ -3,8 +3,50 @@
  * @brief Timer HAL interface for STM32F446RE (basic and PWM modes).
  *
  * Provides initialization and configuration functions for STM32 timers,
- * including basic up-counting timers (e.g., 1 Hz timebase) and PWM output
- * using general-purpose or advanced-control TIMx peripherals.
+ * including basic up-counting timers (e.g., 1 Hz timebase), PWM output
+ * and input capture using general-purpose or advanced-control TIMx peripherals.
+ *
+ * PWM runs on CH1–CH4 in mode 1 or 2, edge- or center-aligned. On TIM1/TIM8
+ * the CH1N–CH3N complementary outputs, dead-time and break input drive
+ * half-bridges. CCRx and ARR are preloaded, so duty changes take effect at
+ * the next update event; `tim_pwm_set_duties()` makes a multi-channel change
+ * land in the same period, and `tim_burst_start()` plays whole buffers of
+ * duty values from DMA with no per-period interrupt.
+ *
+ * Quadrature encoders are decoded in hardware (`tim_encoder_init()`), with
+ * a 32-bit position on every timer and a velocity estimate.
+ *
+ * @code
+ * // 3-phase bridge, 20 kHz center-aligned, 500 ns dead-time, break on BKIN
+ * tim_pwm_init(TIM1, 36000000, 900);     // 36 MHz tick, 900 up + 900 down = 20 kHz
+ * tim_pwm_set_count_mode(TIM1, TIM_COUNT_CENTER1);
+ * for (uint8_t ch = 1; ch <= 3; ch++) tim_pwm_config_output(TIM1, ch, TIM_PWM_MODE1, 0, 1);
+ * tim_bdtr_config_t bd = { .deadtime_ns = 500, .break_enable = 1, .break_high = 0, .auto_restart = 0 };
+ * tim_pwm_bdtr_config(TIM1, &bd);
+ * tim_pwm_start(TIM1);
+ *
+ * // in the 20 kHz control ISR
+ * uint32_t d[3] = { ua, ub, uc };
+ * tim_pwm_set_duties(TIM1, d, 3);
+ * @endcode
+ *
+ * Input capture can stream CCRx values into a circular buffer by DMA, so no
+ * interrupt fires per edge; `tim_ic_measure()` derives period, pulse width,
+ * frequency and duty from the buffer on demand.
+ *
+ * @code
+ * static uint32_t per_buf[16], wid_buf[16];
+ * static tim_ic_dma_t per, wid;
+ *
+ * tim_ic_init(TIM3, 1);                                  // 1 tick = 1 timer clock
+ * tim_ic_pwm_input(TIM3, 1, TIM_IC_RISING, 0);           // CH1 = period, CH2 = width
+ * tim_ic_dma_start(&per, TIM3, 1, per_buf, 16);
+ * tim_ic_dma_start(&wid, TIM3, 2, wid_buf, 16);
+ * tim_pwm_start(TIM3);
+ *
+ * tim_ic_measure_t m;
+ * if (tim_ic_measure(&per, &wid, 8, &m) == 0) { ... m.freq_hz, m.duty_permille ... }
+ * @endcode
  *
  * @note Designed for register-level programming without CMSIS or STM HAL.
  * @author
@@ -16,6 +58,44 @@
 
 #include <stdint.h>
 #include "stm32f4_tim.h"
+#include "stm32f4_dma.h"
+#include "hal_bitband.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Capture stream: one timer channel logged by DMA into a circular buffer.
+ *
+ * Treat as opaque; filled by `tim_ic_dma_start()`.
+ */
+typedef struct {
+    TIM_TypeDef *timx;           /**< Timer */
+    const dma_request_t *req;    /**< DMA stream serving the channel */
+    uint32_t *buf;               /**< Sample buffer */
+    uint16_t len;                /**< Buffer length in samples */
+    uint8_t channel;             /**< Channel 1–4 */
+    uint8_t reset_mode;          /**< 1 if samples are intervals (PWM input), 0 if timestamps */
+} tim_ic_dma_t;
+
+/**
+ * @brief Update event callback, called from the timer's update interrupt.
+ *
+ * @param timx Timer whose counter wrapped (UIF already cleared).
+ * @param ctx  User pointer given to `tim_set_update_callback()`.
+ */
+typedef void (*tim_callback_t)(TIM_TypeDef *timx, void *ctx);
+
+/**
+ * @brief Burst playback callback, called from the DMA stream interrupt.
+ *
+ * @param timx Timer that is playing.
+ * @param part Buffer part that is now free to refill: half 0/1 (circular),
+ *             buffer 0/1 (double), or 0 when a one-shot finished.
+ * @param ctx  User pointer given to `tim_burst_start()`.
+ */
+typedef void (*tim_burst_callback_t)(TIM_TypeDef *timx, uint8_t part, void *ctx);
 
 /** @defgroup HAL_TIM_Functions Timer HAL API
  *  @brief High-level timer setup functions for STM32F446RE.
@@ -35,23 +115,66 @@
  */
 void tim_1hz_init(TIM_TypeDef *timx, uint32_t clk_hz);
 
+/**
+ * @brief Sets a timer's update rate, solving PSC/ARR for its actual clock.
+ *
+ * The timer clock is read from RCC (APB1 or APB2 timer clock). PSC/ARR are
+ * chosen so that (PSC + 1) × (ARR + 1) equals clock / rate exactly, with the
+ * smallest prescaler possible. Does not start the counter.
+ *
+ * @param timx Timer instance (any, including the basic TIM6/TIM7).
+ * @param rate_hz Update events per second.
+ * @return int 0 if the rate is exact, 1 if only approximate, -1 if out of range.
+ */
+int tim_set_rate(TIM_TypeDef *timx, uint32_t rate_hz);
+
+/**
+ * @brief Runs a timer at a given rate with TRGO on its update event.
+ *
+ * Sets the rate with `tim_set_rate()`, selects MMS = update and starts the
+ * counter. Used to pace ADC conversions and DAC samples.
+ *
+ * @param timx Timer instance (TIM1–TIM8, including the basic TIM6/TIM7).
+ * @param rate_hz Trigger events per second.
+ * @return int 0 if the rate is exact, 1 if only approximate, -1 if out of range.
+ */
+int tim_set_trgo_rate(TIM_TypeDef *timx, uint32_t rate_hz);
+
+/**
+ * @brief Routes a timer's update interrupt to a callback and enables it.
+ *
+ * The HAL owns the update vectors of TIM1–TIM8 (TIM1/TIM8 via the shared
+ * TIM1_UP_TIM10 / TIM8_UP_TIM13 lines, TIM6 via TIM6_DAC).
+ *
+ * @param timx TIM1–TIM8.
+ * @param cb Callback, or 0 to detach (disables UIE).
+ * @param ctx User pointer passed to `cb`.
+ * @param priority NVIC priority 0–15 of the update vector.
+ * @return int 0 on success, -1 on unsupported timer.
+ */
+int tim_set_update_callback(TIM_TypeDef *timx, tim_callback_t cb, void *ctx, uint8_t priority);
+
 /**
  * @brief Initializes a timer for PWM output.
  *
- * Configures prescaler and auto-reload register to define the PWM frequency.
- * Use with `tim_pwm_config_channel()` to assign duty cycle and channel behavior.
+ * Derives the prescaler from the timer's kernel clock (`rcc_get_pclk()`) so
+ * the counter ticks at `tick_hz`, and sets the period to `arr` ticks; the
+ * PWM frequency is `tick_hz / arr`. Use with `tim_pwm_config_channel()` to
+ * assign duty cycle and channel behavior.
  *
  * @param timx Pointer to TIMx instance.
- * @param prescaler Prescaler value (PSC register) — pass raw value, not minus one.
- * @param arr Auto-reload value (ARR register) — pass raw value, not minus one.
+ * @param tick_hz Counter frequency in Hz, or 0 for the undivided timer clock.
+ *        Rounded to the nearest integer division of the timer clock.
+ * @param arr Period in ticks (ARR register) — pass raw value, not minus one.
  */
-void tim_pwm_init(TIM_TypeDef *timx, uint16_t prescaler, uint16_t arr);
+void tim_pwm_init(TIM_TypeDef *timx, uint32_t tick_hz, uint16_t arr);
 
 /**
  * @brief Configures a specific channel of the timer for PWM output.
  *
  * Sets PWM mode 1 on the given channel, sets duty cycle via CCRx, enables preload
- * for smooth transitions, and enables channel output.
+ * for smooth transitions, and enables channel output. Same as
+ * `tim_pwm_config_output(timx, channel, TIM_PWM_MODE1, duty, 0)`.
  *
  * @param timx Timer instance (e.g., TIM2).
  * @param channel Channel number (1–4).
@@ -59,6 +182,77 @@ void tim_pwm_init(TIM_TypeDef *timx, uint16_t prescaler, uint16_t arr);
  */
 void tim_pwm_config_channel(TIM_TypeDef *timx, uint8_t channel, uint16_t duty);
 
+/**
+ * @brief Configures a channel for PWM with mode and optional complementary output.
+ *
+ * Enables CCRx preload, so later duty writes apply at the next update. On
+ * TIM1/TIM8 also sets MOE so the outputs are driven.
+ *
+ * @param timx Timer instance.
+ * @param channel Channel number (1–4).
+ * @param mode `TIM_PWM_MODE1` or `TIM_PWM_MODE2`.
+ * @param duty Initial compare value (0–ARR).
+ * @param complementary 1 to also enable CHxN (TIM1/TIM8, channels 1–3 only).
+ * @return int 0 on success, -1 on invalid channel or complementary request.
+ */
+int tim_pwm_config_output(TIM_TypeDef *timx, uint8_t channel, tim_pwm_mode_t mode,
+                          uint32_t duty, uint8_t complementary);
+
+/**
+ * @brief Selects edge- or center-aligned counting.
+ *
+ * Must be called while the counter is stopped (before `tim_pwm_start()`).
+ *
+ * @param timx Timer instance (not TIM6/TIM7).
+ * @param mode Counter alignment.
+ */
+void tim_pwm_set_count_mode(TIM_TypeDef *timx, tim_count_mode_t mode);
+
+/**
+ * @brief Programs dead-time and break input, then enables the main output (TIM1/TIM8).
+ *
+ * Dead-time is rounded up to what the DTG encoding can represent (up to
+ * 1008 timer clock cycles, e.g. 5.6 µs at 180 MHz). OSSR/OSSI are set so
+ * disabled or broken outputs are driven to their inactive/idle level rather
+ * than released. BDTR is written once in full.
+ *
+ * @param timx `TIM1` or `TIM8`.
+ * @param cfg Dead-time and break settings.
+ * @return int 0 on success, -1 if not an advanced timer or the dead-time is too long.
+ */
+int tim_pwm_bdtr_config(TIM_TypeDef *timx, const tim_bdtr_config_t *cfg);
+
+/**
+ * @brief Sets one channel's duty (single store to CCRx, applied at the next update).
+ *
+ * @param timx Timer instance.
+ * @param channel Channel number (1–4).
+ * @param duty Compare value (0–ARR).
+ */
+static inline void tim_pwm_set_duty(TIM_TypeDef *timx, uint8_t channel, uint32_t duty) {
+    (&timx->CCR1)[(channel - 1U) & 0x3U] = duty;
+}
+
+/**
+ * @brief Updates CH1..CH`count` so they all switch in the same PWM period.
+ *
+ * Update events are held off (CR1.UDIS) while the CCRs are written, so the
+ * preload registers can't be transferred with only some channels updated.
+ * If the update falls inside the window the whole set applies one period
+ * later. Cost: two bit-band stores plus one store per channel.
+ *
+ * @param timx Timer instance.
+ * @param duty Compare values for CH1, CH2, ...
+ * @param count Number of channels (1–4).
+ */
+static inline void tim_pwm_set_duties(TIM_TypeDef *timx, const uint32_t *duty, uint8_t count) {
+    volatile uint32_t *ccr = &timx->CCR1;
+
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_UDIS_POS) = 1;
+    for (uint8_t i = 0; i < count && i < 4; i++) ccr[i] = duty[i];
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_UDIS_POS) = 0;
+}
+
 /**
  * @brief Starts the timer counter (CEN = 1).
  *
@@ -68,6 +262,190 @@ void tim_pwm_config_channel(TIM_TypeDef *timx, uint8_t channel, uint16_t duty);
  */
 void tim_pwm_start(TIM_TypeDef *timx);
 
+/**
+ * @brief Streams compare values into CCRx on every update event by DMA burst.
+ *
+ * Each update event triggers one burst through DCR/DMAR that writes
+ * `nch` consecutive registers starting at CCR`first_ch`, so the buffer is
+ * a sequence of frames `{ CCRfirst, CCRfirst+1, ... }`, one frame per PWM
+ * period. With CCR preload on, each frame drives the period after the one
+ * in which it is written. The channels must be configured as PWM outputs and
+ * the counter started separately; no CPU work happens per period.
+ *
+ * Available on TIM1–TIM5 and TIM8. TIM4 uses DMA1 stream 6, shared with the
+ * USART2 transmit ring; TIM2 and TIM3 share their stream with the CH3 / CH4
+ * capture requests.
+ *
+ * @param timx Timer instance.
+ * @param first_ch First channel written per burst (1–4).
+ * @param nch Channels per burst (1 to 5 - first_ch).
+ * @param buf0 Frames (16-bit compare values).
+ * @param buf1 Second buffer for `TIM_BURST_DOUBLE`, otherwise ignored.
+ * @param frames Number of frames in each buffer; `frames * nch` ≤ 65535.
+ * @param mode One-shot, circular or double-buffered.
+ * @param cb Refill/done callback, or 0.
+ * @param ctx User pointer passed to `cb`.
+ * @return int 0 if started, -1 on unsupported timer or invalid arguments.
+ */
+int tim_burst_start(TIM_TypeDef *timx, uint8_t first_ch, uint8_t nch,
+                    const uint16_t *buf0, const uint16_t *buf1, uint16_t frames,
+                    tim_burst_mode_t mode, tim_burst_callback_t cb, void *ctx);
+
+/**
+ * @brief Stops burst playback; CCRx keep the last frame written.
+ *
+ * @param timx Timer instance.
+ */
+void tim_burst_stop(TIM_TypeDef *timx);
+
+/**
+ * @brief Configures a timer as a quadrature encoder interface and starts it.
+ *
+ * Channel 1/2 inputs (TI1/TI2) are decoded in hardware, so CPU load does
+ * not depend on shaft speed. TIM2/TIM5 count in 32 bits directly; on the
+ * 16-bit TIM1/TIM3/TIM4/TIM8 the update interrupt extends the count to
+ * 32 bits (one interrupt per 65536 counts).
+ *
+ * The CH1/CH2 pins must be set to their timer alternate function.
+ *
+ * @param timx TIM1–TIM5 or TIM8.
+ * @param cfg Decoding mode, filter and direction.
+ * @return int 0 on success, -1 on unsupported timer.
+ */
+int tim_encoder_init(TIM_TypeDef *timx, const tim_encoder_config_t *cfg);
+
+/**
+ * @brief Returns the 32-bit signed encoder position in counts.
+ *
+ * Safe against a counter wrap that has not been serviced yet.
+ *
+ * @param timx Encoder timer.
+ * @return int32_t Position.
+ */
+int32_t tim_encoder_position(TIM_TypeDef *timx);
+
+/**
+ * @brief Sets the encoder position (e.g., 0 at a homing switch).
+ *
+ * @param timx Encoder timer.
+ * @param pos New position in counts.
+ */
+void tim_encoder_set_position(TIM_TypeDef *timx, int32_t pos);
+
+/**
+ * @brief Estimates velocity from the position change since the previous call.
+ *
+ * Call at a steady rate (e.g., from a control loop); the first call after
+ * init returns 0. Uses `hal_micros()` for the elapsed time.
+ *
+ * @param timx Encoder timer.
+ * @return int32_t Velocity in counts per second (negative when reversing).
+ */
+int32_t tim_encoder_velocity(TIM_TypeDef *timx);
+
+/**
+ * @brief Sets a timer up as a free-running counter for input capture.
+ *
+ * ARR is set to its maximum (0xFFFF, or 0xFFFFFFFF on TIM2/TIM5), so
+ * capture differences wrap naturally. Does not start the counter.
+ *
+ * @param timx Timer instance.
+ * @param prescaler Prescaler (raw, not minus one); tick = timer clock / prescaler.
+ */
+void tim_ic_init(TIM_TypeDef *timx, uint16_t prescaler);
+
+/**
+ * @brief Configures one channel as input capture on its own pin.
+ *
+ * @param timx Timer instance.
+ * @param cfg Channel, edge, prescaler and filter.
+ * @return int 0 on success, -1 on invalid channel.
+ */
+int tim_ic_config_channel(TIM_TypeDef *timx, const tim_ic_config_t *cfg);
+
+/**
+ * @brief Configures PWM-input mode on a channel pair (CH1/CH2).
+ *
+ * The signal on TI`channel` is captured twice: by `channel` on `edge`, which
+ * also resets the counter (slave reset mode), so its CCR holds the period;
+ * and by the paired channel on the opposite edge, whose CCR holds the pulse
+ * width. With `TIM_IC_RISING` the width is the high time.
+ *
+ * @param timx Timer instance (one with a slave mode controller, e.g. TIM1–5, TIM8, TIM9, TIM12).
+ * @param channel Input channel: 1 (pin TI1, width on CH2) or 2 (pin TI2, width on CH1).
+ * @param edge `TIM_IC_RISING` or `TIM_IC_FALLING`.
+ * @param filter ICxF filter code 0–15 applied to both channels.
+ * @return int 0 on success, -1 on invalid channel or edge.
+ */
+int tim_ic_pwm_input(TIM_TypeDef *timx, uint8_t channel, tim_ic_edge_t edge, uint8_t filter);
+
+/**
+ * @brief Returns the last captured value of a channel (CCRx).
+ *
+ * Reading clears the channel's capture flag.
+ *
+ * @param timx Timer instance.
+ * @param channel Channel 1–4.
+ * @return uint32_t CCRx.
+ */
+uint32_t tim_ic_read(TIM_TypeDef *timx, uint8_t channel);
+
+/**
+ * @brief Starts logging a capture channel into a circular buffer by DMA.
+ *
+ * Every capture event writes CCRx to the next buffer slot; the stream wraps
+ * at `len` and raises no interrupts. Configure the channel first
+ * (`tim_ic_config_channel()` or `tim_ic_pwm_input()`).
+ *
+ * Available on TIM1–TIM5 and TIM8 (TIM4 CH4 has no DMA request). TIM2 CH2
+ * uses DMA1 stream 6, shared with the USART2 transmit ring.
+ *
+ * @param cap Stream object to fill.
+ * @param timx Timer instance.
+ * @param channel Channel 1–4.
+ * @param buf Sample buffer.
+ * @param len Buffer length in samples (2–65535).
+ * @return int 0 if started, -1 if the channel has no DMA request or `len` < 2.
+ */
+int tim_ic_dma_start(tim_ic_dma_t *cap, TIM_TypeDef *timx, uint8_t channel,
+                     uint32_t *buf, uint16_t len);
+
+/**
+ * @brief Stops a capture stream; the buffer keeps its contents.
+ *
+ * @param cap Stream object.
+ */
+void tim_ic_dma_stop(tim_ic_dma_t *cap);
+
+/**
+ * @brief Number of valid samples in a capture buffer (saturates at `len`).
+ *
+ * @param cap Stream object.
+ * @return uint16_t Samples written so far.
+ */
+uint16_t tim_ic_dma_count(const tim_ic_dma_t *cap);
+
+/**
+ * @brief Computes period, width, frequency and duty from capture buffers.
+ *
+ * `period` may hold timestamps (plain capture: intervals are successive
+ * differences) or periods (PWM input). `width` must be the width channel of
+ * a PWM-input pair, or 0. The tick rate is taken from the timer's clock and
+ * prescaler.
+ *
+ * @param period Period capture stream.
+ * @param width Width capture stream, or 0.
+ * @param n Number of most recent intervals to average (at least 1).
+ * @param out Result.
+ * @return int 0 on success, -1 if fewer than `n` intervals are logged yet or the period is 0.
+ */
+int tim_ic_measure(const tim_ic_dma_t *period, const tim_ic_dma_t *width,
+                   uint16_t n, tim_ic_measure_t *out);
+
 /** @} */
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif // HAL_TIM_H
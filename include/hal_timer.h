@@ -0,0 +1,111 @@
+/**
+ * @file hal_timer.h
+ * @brief Software timers on a hierarchical timing wheel for STM32F446RE.
+ *
+ * Schedules any number of one-shot and periodic callbacks on the 1 ms system
+ * tick (`hal_tick_init()`). Timers live in caller-provided `hal_timer_t`
+ * objects (no heap) linked into a 4-level wheel of 64 slots per level, so
+ * start, stop and expiry are O(1) regardless of how many timers are armed.
+ *
+ * The SysTick interrupt only counts ticks. The wheel is advanced and the
+ * callbacks run from `hal_timer_process()`, called from the main loop, so
+ * callbacks execute in thread context and may block, print, or restart timers.
+ * `hal_timer_start()` / `hal_timer_stop()` can also be called from ISRs.
+ *
+ * @code
+ * static hal_timer_t blink;
+ *
+ * static void blink_cb(void *ctx) {
+ *     gpio_toggle(PIN('A', 5));
+ * }
+ *
+ * hal_timer_init(&blink, blink_cb, 0);
+ * hal_timer_start(&blink, 500, 500);     // first after 500 ms, then every 500 ms
+ *
+ * while (1) {
+ *     hal_timer_process();
+ * }
+ * @endcode
+ */
+
+#ifndef HAL_TIMER_H
+#define HAL_TIMER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Timer expiry callback type.
+ *
+ * @param ctx User pointer given to `hal_timer_init()`.
+ */
+typedef void (*hal_timer_cb_t)(void *ctx);
+
+/**
+ * @brief Software timer. Treat as opaque; allocate statically.
+ */
+typedef struct hal_timer {
+    struct hal_timer *next;    /**< Next timer in the same wheel slot */
+    struct hal_timer **pprev;  /**< Link pointing to this timer, 0 when not armed */
+    uint32_t expires;          /**< Absolute expiry tick */
+    uint32_t period;           /**< Reload interval in ticks, 0 for one-shot */
+    hal_timer_cb_t cb;         /**< Expiry callback */
+    void *ctx;                 /**< User pointer passed to `cb` */
+} hal_timer_t;
+
+/**
+ * @brief Prepares a timer object; does not arm it.
+ *
+ * @param t   Timer.
+ * @param cb  Callback run by `hal_timer_process()` when the timer expires.
+ * @param ctx User pointer passed to `cb`.
+ */
+void hal_timer_init(hal_timer_t *t, hal_timer_cb_t cb, void *ctx);
+
+/**
+ * @brief Arms (or re-arms) a timer.
+ *
+ * Re-arming an active timer moves it to the new expiry.
+ *
+ * @param t         Timer.
+ * @param delay_ms  Time until the first expiry in milliseconds.
+ * @param period_ms Reload interval in milliseconds, 0 for one-shot. Periodic
+ *                  timers are rescheduled from their previous expiry, so they don't drift.
+ */
+void hal_timer_start(hal_timer_t *t, uint32_t delay_ms, uint32_t period_ms);
+
+/**
+ * @brief Disarms a timer. Does nothing if it isn't armed.
+ *
+ * Once this returns the callback will not be called (unless already running).
+ *
+ * @param t Timer.
+ */
+void hal_timer_stop(hal_timer_t *t);
+
+/**
+ * @brief Checks whether a timer is armed.
+ *
+ * @param t Timer.
+ * @return int 1 if armed, 0 otherwise.
+ */
+int hal_timer_is_active(const hal_timer_t *t);
+
+/**
+ * @brief Advances the wheel to the current tick and runs due callbacks.
+ *
+ * Call regularly from the main loop. If it wasn't called for a while, all
+ * ticks in between are caught up in order.
+ *
+ * @return uint32_t Number of callbacks run.
+ */
+uint32_t hal_timer_process(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_TIMER_H
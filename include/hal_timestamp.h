@@ -0,0 +1,76 @@
+/**
+ * @file hal_timestamp.h
+ * @brief 64-bit hardware timestamp counter from cascaded TIM2/TIM5.
+ *
+ * TIM2 counts the APB1 timer clock (90 MHz at 180 MHz HCLK) over its full
+ * 32-bit range and emits its update event as TRGO; TIM5 is clocked by that
+ * trigger (external clock mode 1 on ITR0) and counts TIM2 wraps. Together
+ * they form a 64-bit counter that advances in hardware with no interrupt,
+ * so timestamps stay valid with interrupts masked and cost only three
+ * peripheral reads.
+ *
+ * Takes over TIM2 and TIM5 entirely.
+ *
+ * @code
+ * hal_ts_init();
+ *
+ * uint64_t t0 = hal_ts_now();
+ * do_work();
+ * uint64_t ns = hal_ts_to_ns(hal_ts_now() - t0);
+ * @endcode
+ */
+
+#ifndef HAL_TIMESTAMP_H
+#define HAL_TIMESTAMP_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configures the TIM2 → TIM5 chain, zeroes it and starts counting.
+ *
+ * Call again after changing the clock tree so the rate used by the
+ * conversions is refreshed.
+ */
+void hal_ts_init(void);
+
+/**
+ * @brief Returns the current 64-bit counter value (tear-free).
+ *
+ * Safe from any context, including with interrupts disabled.
+ *
+ * @return uint64_t Ticks since `hal_ts_init()`.
+ */
+uint64_t hal_ts_now(void);
+
+/**
+ * @brief Counter rate in Hz (the APB1 timer clock at init time).
+ *
+ * @return uint32_t Ticks per second.
+ */
+uint32_t hal_ts_hz(void);
+
+/**
+ * @brief Converts ticks to nanoseconds without intermediate overflow.
+ *
+ * @param ticks Tick count or difference.
+ * @return uint64_t Nanoseconds (truncated).
+ */
+uint64_t hal_ts_to_ns(uint64_t ticks);
+
+/**
+ * @brief Converts ticks to microseconds without intermediate overflow.
+ *
+ * @param ticks Tick count or difference.
+ * @return uint64_t Microseconds (truncated).
+ */
+uint64_t hal_ts_to_us(uint64_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_TIMESTAMP_H
@@ -2,8 +2,8 @@
  * @file hal_types.h
  * @brief Core HAL type definitions and centralized module includes for STM32F411RE.
  *
- * This header includes all major HAL modules (GPIO, RCC, SysTick, TIM, UART, SPI)
- * and defines basic types used across the HAL codebase. It serves as a common import
+ * This header includes all major HAL modules (GPIO, RCC, peripheral descriptors, SysTick, TIM, UART, SPI, I2C, DMA, ADC, DAC, NVIC, EXTI, profiling, software timers, periodic tasks, timestamps),
+ * the SRAM placement and bit-band helpers, and defines basic types used across the HAL codebase. It serves as a common import
  * point for user applications and higher-level drivers.
  */
 
@@ -14,10 +14,23 @@
 
 #include "hal_gpio.h"
 #include "hal_rcc.h"
+#include "hal_periph.h"
 #include "hal_systick.h"
 #include "hal_tim.h"
 #include "hal_uart.h"
 #include "hal_spi.h"
+#include "hal_i2c.h"
+#include "hal_dma.h"
+#include "hal_adc.h"
+#include "hal_dac.h"
+#include "hal_nvic.h"
+#include "hal_ramfunc.h"
+#include "hal_bitband.h"
+#include "hal_profile.h"
+#include "hal_timer.h"
+#include "hal_exti.h"
+#include "hal_task.h"
+#include "hal_timestamp.h"
 
 /**
  * @brief Boolean type definition.
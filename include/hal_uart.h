@@ -3,19 +3,56 @@
  * @brief High-level UART interface for STM32F411RE.
  *
  * Provides simple UART communication functions including initialization,
- * string transmission, and byte reception using polling (blocking mode).
+ * string transmission, and byte reception. Transmission is queued into a
+ * per-port ring buffer that is drained by the DMA stream mapped to that USART,
+ * so `uart_print()` returns as soon as the bytes are buffered. Reception is
+ * interrupt-driven (RXNE/IDLE) into a per-port lock-free ring buffer.
  * Built on top of direct register access to STM32F4 UART hardware.
  */
 
 #ifndef HAL_UART_H
 #define HAL_UART_H
 
+#include <stddef.h>
 #include "stm32f4_uart.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of each port's transmit ring buffer in bytes.
+ *
+ * Must be a power of two. Override at build time (e.g. `-DUART_TX_BUF_SIZE=512`).
+ */
+#ifndef UART_TX_BUF_SIZE
+#define UART_TX_BUF_SIZE 256U
+#endif
+
+/**
+ * @brief Size of each port's receive ring buffer in bytes.
+ *
+ * Must be a power of two. Bytes arriving while the ring is full are dropped.
+ */
+#ifndef UART_RX_BUF_SIZE
+#define UART_RX_BUF_SIZE 256U
+#endif
+
+/**
+ * @brief Idle-line callback type.
+ *
+ * Called from the USART interrupt when the line goes idle after a burst of
+ * received bytes, i.e. once per packet instead of once per byte.
+ *
+ * @param uart      Port that detected the idle line.
+ * @param available Bytes currently waiting in the receive ring.
+ */
+typedef void (*uart_idle_cb_t)(UART_TypeDef *uart, size_t available);
+
 /**
  * @brief Receives a single byte from the UART peripheral (blocking).
  *
- * Waits until the RXNE (Receive Not Empty) flag is set, then reads from the data register.
+ * Waits until the receive ring holds at least one byte, then pops it.
  *
  * @param uart Pointer to UART peripheral (e.g., `USART1`, `USART2`, etc.)
  * @return uint8_t Received byte from the UART.
@@ -25,30 +62,97 @@
 uint8_t uart_read(UART_TypeDef *uart);
 
 /**
- * @brief Sends a null-terminated string over UART (blocking).
+ * @brief Returns the number of received bytes waiting in the ring (non-blocking).
  *
- * Transmits each character in the given string one by one, waiting for
- * the TXE (Transmit Empty) flag before sending the next character.
+ * @param uart Pointer to UART peripheral.
+ * @return size_t Bytes available to `uart_read_buf()`.
+ */
+size_t uart_read_available(UART_TypeDef *uart);
+
+/**
+ * @brief Copies up to `max` received bytes out of the ring (non-blocking).
+ *
+ * @param uart Pointer to UART peripheral.
+ * @param buf  Destination buffer.
+ * @param max  Capacity of `buf` in bytes.
+ * @return size_t Number of bytes copied (0 if nothing was received).
+ */
+size_t uart_read_buf(UART_TypeDef *uart, void *buf, size_t max);
+
+/**
+ * @brief Registers a callback fired from the ISR when the RX line goes idle.
+ *
+ * Pass `0` to remove the callback. The callback runs in interrupt context;
+ * keep it short (e.g. drain with `uart_read_buf()` or set a flag).
+ *
+ * @param uart Pointer to UART peripheral.
+ * @param cb   Idle-line callback, or 0.
+ */
+void uart_set_idle_callback(UART_TypeDef *uart, uart_idle_cb_t cb);
+
+/**
+ * @brief Queues a null-terminated string for transmission over UART.
+ *
+ * Copies the string into the port's transmit ring and returns; the DMA stream
+ * for this USART sends it in the background.
  *
  * @param uart Pointer to UART peripheral.
  * @param msg  Null-terminated string to transmit.
  *
- * @note This function blocks until all characters have been sent.
+ * @note Only blocks if the ring buffer is full, until enough space is freed.
  */
 void uart_print(UART_TypeDef *uart, const char *msg);
 
+/**
+ * @brief Queues `len` bytes for transmission over UART.
+ *
+ * Same behaviour as `uart_print()` but for arbitrary binary data.
+ *
+ * @param uart Pointer to UART peripheral.
+ * @param data Bytes to transmit.
+ * @param len  Number of bytes.
+ *
+ * @note Only blocks if the ring buffer is full, until enough space is freed.
+ */
+void uart_write_buf(UART_TypeDef *uart, const void *data, size_t len);
+
+/**
+ * @brief Returns how many queued bytes have not been sent yet.
+ *
+ * Also hands the next queued chunk to DMA if the previous one has finished,
+ * so it can be used as a non-blocking poll.
+ *
+ * @param uart Pointer to UART peripheral.
+ * @return size_t Bytes still waiting in the transmit ring (0 = all handed off).
+ */
+size_t uart_tx_pending(UART_TypeDef *uart);
+
+/**
+ * @brief Blocks until every queued byte has left the transmitter.
+ *
+ * Waits for the ring buffer to drain and for the final stop bit (TC flag).
+ * Use before entering low-power modes or reconfiguring the port.
+ *
+ * @param uart Pointer to UART peripheral.
+ */
+void uart_flush(UART_TypeDef *uart);
+
 /**
  * @brief Initializes the UART peripheral with the given baud rate.
  *
  * Enables the UART clock (must be done separately), configures the baud rate
- * using BRR, and enables transmitter and receiver functionality.
+ * using BRR computed from the port's bus clock (`rcc_get_pclk()`), and enables
+ * transmitter and receiver functionality. Also enables
+ * the DMA controller clock and TX DMA request (CR3.DMAT) used by the transmit ring,
+ * and the RXNE/IDLE interrupts plus the port's NVIC line for the receive ring.
  *
  * @param uart       Pointer to UART peripheral to configure.
- * @param periph_clk Peripheral clock frequency in Hz (e.g., 16000000 for 16 MHz).
  * @param baud       Desired baud rate (use `baud_rate_t` enum for common rates).
- *
- * @note Does not configure interrupts or DMA. This is a basic polling-based setup.
  */
-void uart_init(UART_TypeDef *uart, uint32_t periph_clk, baud_rate_t baud);
+void uart_init(UART_TypeDef *uart, baud_rate_t baud);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif // HAL_UART_H
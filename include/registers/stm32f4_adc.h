@@ -0,0 +1,169 @@
+/**
+ * @file stm32f4_adc.h
+ * @brief Register map and bit definitions for ADC1–ADC3 on STM32F446RE.
+ *
+ * Three 12-bit successive-approximation ADCs share a common control block
+ * (prescaler, multi-ADC mode, common data register). Regular conversions run
+ * a sequence of up to 16 channels (SQR1–SQR3), each with its own sampling
+ * time (SMPR1/SMPR2), started by software or an external trigger.
+ *
+ * The layout is based on RM0390 Reference Manual.
+ */
+
+#ifndef STM32F4_ADC_H
+#define STM32F4_ADC_H
+
+#include <stdint.h>
+
+/// @name ADC Base Addresses (APB2)
+/// @{
+#define ADC1_BASE        0x40012000UL
+#define ADC2_BASE        0x40012100UL
+#define ADC3_BASE        0x40012200UL
+#define ADC_COMMON_BASE  0x40012300UL
+#define ADC1       ((ADC_TypeDef *) ADC1_BASE)                /**< ADC1 (multi-ADC master) */
+#define ADC2       ((ADC_TypeDef *) ADC2_BASE)                /**< ADC2 */
+#define ADC3       ((ADC_TypeDef *) ADC3_BASE)                /**< ADC3 */
+#define ADC_COMMON ((ADC_Common_TypeDef *) ADC_COMMON_BASE)   /**< Registers shared by all three ADCs */
+/// @}
+
+/**
+ * @brief Highest ADC kernel clock in Hz (VDDA ≥ 2.4 V).
+ */
+#define ADC_MAX_CLOCK_HZ 36000000UL
+
+/// @name ADC_SR Bit Flags
+/// @{
+#define ADC_SR_EOC        (1U << 1)    /**< Regular conversion complete */
+#define ADC_SR_STRT       (1U << 4)    /**< Regular conversion started */
+#define ADC_SR_OVR        (1U << 5)    /**< Overrun: data lost */
+/// @}
+
+/// @name ADC_CR1 Bit Definitions
+/// @{
+#define ADC_CR1_SCAN      (1U << 8)    /**< Scan mode: convert the whole sequence */
+#define ADC_CR1_RES_POS   24U          /**< Resolution field position (2 bits) */
+#define ADC_CR1_RES_MSK   (0x3U << 24)
+/// @}
+
+/// @name ADC_CR2 Bit Definitions
+/// @{
+#define ADC_CR2_ADON      (1U << 0)    /**< ADC on */
+#define ADC_CR2_CONT      (1U << 1)    /**< Continuous conversion */
+#define ADC_CR2_DMA       (1U << 8)    /**< DMA request enable */
+#define ADC_CR2_DDS       (1U << 9)    /**< Keep issuing DMA requests after the last transfer */
+#define ADC_CR2_EOCS      (1U << 10)   /**< EOC after each conversion (not only each sequence) */
+#define ADC_CR2_EXTSEL_POS 24U         /**< Regular external trigger selection (4 bits) */
+#define ADC_CR2_EXTSEL_MSK (0xFU << 24)
+#define ADC_CR2_EXTEN_RISING (1U << 28) /**< Trigger on rising edge */
+#define ADC_CR2_EXTEN_MSK (0x3U << 28)
+#define ADC_CR2_SWSTART   (1U << 30)   /**< Start regular conversion */
+/// @}
+
+/// @name ADC_SQR1 Fields
+/// @{
+#define ADC_SQR1_L_POS    20U          /**< Sequence length minus one (4 bits) */
+/// @}
+
+/// @name ADC_CCR Bit Definitions
+/// @{
+#define ADC_CCR_MULTI_MSK  (0x1FU << 0)  /**< Multi-ADC mode selection */
+#define ADC_CCR_DELAY_POS  8U            /**< Delay between interleaved conversions: 5 + n ADC clocks */
+#define ADC_CCR_DELAY_MSK  (0xFU << 8)
+#define ADC_CCR_DDS        (1U << 13)    /**< Multi-mode: keep issuing DMA requests */
+#define ADC_CCR_DMA_MODE2  (2U << 14)    /**< Multi-mode DMA mode 2: two results per 32-bit CDR read */
+#define ADC_CCR_DMA_MSK    (3U << 14)
+#define ADC_CCR_ADCPRE_POS 16U           /**< ADC prescaler: PCLK2 / (2, 4, 6, 8) */
+#define ADC_CCR_ADCPRE_MSK (0x3U << 16)
+/// @}
+
+/**
+ * @brief Register layout of one ADC.
+ */
+typedef struct {
+    volatile uint32_t SR;      /**< 0x00 Status register */
+    volatile uint32_t CR1;     /**< 0x04 Control register 1 */
+    volatile uint32_t CR2;     /**< 0x08 Control register 2 */
+    volatile uint32_t SMPR1;   /**< 0x0C Sample time register 1 (channels 10–18) */
+    volatile uint32_t SMPR2;   /**< 0x10 Sample time register 2 (channels 0–9) */
+    volatile uint32_t JOFR[4]; /**< 0x14 Injected channel data offset registers */
+    volatile uint32_t HTR;     /**< 0x24 Watchdog higher threshold register */
+    volatile uint32_t LTR;     /**< 0x28 Watchdog lower threshold register */
+    volatile uint32_t SQR1;    /**< 0x2C Regular sequence register 1 (SQ13–16, length) */
+    volatile uint32_t SQR2;    /**< 0x30 Regular sequence register 2 (SQ7–12) */
+    volatile uint32_t SQR3;    /**< 0x34 Regular sequence register 3 (SQ1–6) */
+    volatile uint32_t JSQR;    /**< 0x38 Injected sequence register */
+    volatile uint32_t JDR[4];  /**< 0x3C Injected data registers */
+    volatile uint32_t DR;      /**< 0x4C Regular data register */
+} ADC_TypeDef;
+
+/**
+ * @brief Register layout of the common ADC block.
+ */
+typedef struct {
+    volatile uint32_t CSR;     /**< 0x00 Common status register (flags of all ADCs) */
+    volatile uint32_t CCR;     /**< 0x04 Common control register */
+    volatile uint32_t CDR;     /**< 0x08 Common regular data register (multi-ADC modes) */
+} ADC_Common_TypeDef;
+
+/**
+ * @brief Sampling time per channel (SMPx), in ADC clock cycles.
+ *
+ * Total conversion time is the sampling time plus 12 (12-bit) down to
+ * 6 (6-bit) cycles.
+ */
+typedef enum {
+    ADC_SMP_3   = 0,   /**< 3 cycles */
+    ADC_SMP_15  = 1,   /**< 15 cycles */
+    ADC_SMP_28  = 2,   /**< 28 cycles */
+    ADC_SMP_56  = 3,   /**< 56 cycles */
+    ADC_SMP_84  = 4,   /**< 84 cycles */
+    ADC_SMP_112 = 5,   /**< 112 cycles */
+    ADC_SMP_144 = 6,   /**< 144 cycles */
+    ADC_SMP_480 = 7    /**< 480 cycles */
+} adc_sample_time_t;
+
+/**
+ * @brief Conversion resolution (CR1.RES).
+ */
+typedef enum {
+    ADC_RES_12BIT = 0, /**< 12 bits, 15 cycles minimum */
+    ADC_RES_10BIT = 1, /**< 10 bits, 13 cycles minimum */
+    ADC_RES_8BIT  = 2, /**< 8 bits, 11 cycles minimum */
+    ADC_RES_6BIT  = 3  /**< 6 bits, 9 cycles minimum */
+} adc_resolution_t;
+
+/**
+ * @brief Start source of a regular sequence.
+ *
+ * Timer triggers carry their EXTSEL code; the timer's TRGO must be its
+ * update event (see `adc_set_trigger_rate()`).
+ */
+typedef enum {
+    ADC_TRIG_SOFTWARE  = 0xFF,  /**< Software start, then free-running (continuous mode) */
+    ADC_TRIG_TIM2_TRGO = 0x6,   /**< TIM2 TRGO */
+    ADC_TRIG_TIM3_TRGO = 0x8,   /**< TIM3 TRGO */
+    ADC_TRIG_TIM8_TRGO = 0xE    /**< TIM8 TRGO */
+} adc_trigger_t;
+
+/**
+ * @brief Multi-ADC mode (CCR.MULTI). ADC1 is the master and owns the DMA.
+ */
+typedef enum {
+    ADC_MODE_INDEPENDENT        = 0x00,  /**< Each ADC runs on its own */
+    ADC_MODE_DUAL_INTERLEAVED   = 0x07,  /**< ADC1, ADC2 alternate on the same channel */
+    ADC_MODE_TRIPLE_INTERLEAVED = 0x17   /**< ADC1, ADC2, ADC3 rotate on the same channel */
+} adc_multi_mode_t;
+
+/**
+ * @brief ADC configuration structure used in adc_init().
+ */
+typedef struct {
+    const uint8_t *channels;        /**< Regular sequence, channel numbers 0–18 */
+    uint8_t count;                  /**< Sequence length 1–16 (more than 1 enables scan) */
+    adc_sample_time_t sample_time;  /**< Sampling time applied to every channel in the sequence */
+    adc_resolution_t resolution;    /**< Conversion resolution */
+    adc_trigger_t trigger;          /**< Start source */
+} adc_config_t;
+
+#endif // STM32F4_ADC_H
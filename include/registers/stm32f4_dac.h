@@ -0,0 +1,101 @@
+/**
+ * @file stm32f4_dac.h
+ * @brief Register map and bit definitions for the DAC on STM32F446RE.
+ *
+ * One 12-bit DAC block with two output channels: OUT1 on PA4, OUT2 on PA5.
+ * Each channel copies its holding register (DHRx) to the output register
+ * (DORx) on a trigger, optionally adding a noise (LFSR) or triangle wave, and
+ * can request a DMA transfer per trigger to refill DHRx.
+ *
+ * Channel 2 uses the same bit layout as channel 1 shifted up by 16
+ * (`DAC_CR_CH_SHIFT`).
+ *
+ * The layout is based on RM0390 Reference Manual.
+ */
+
+#ifndef STM32F4_DAC_H
+#define STM32F4_DAC_H
+
+#include <stdint.h>
+
+/// @name DAC Base Address (APB1)
+/// @{
+#define DAC_BASE  0x40007400UL
+#define DAC       ((DAC_TypeDef *) DAC_BASE)
+/// @}
+
+/**
+ * @brief Full-scale code of a 12-bit conversion.
+ */
+#define DAC_MAX_VALUE 4095U
+
+/// @name DAC_CR Bit Definitions (channel 1)
+/// @{
+#define DAC_CR_CH_SHIFT   16U          /**< Offset of the channel 2 fields */
+#define DAC_CR_EN         (1U << 0)    /**< Channel enable */
+#define DAC_CR_BOFF       (1U << 1)    /**< Output buffer disable */
+#define DAC_CR_TEN        (1U << 2)    /**< Trigger enable */
+#define DAC_CR_TSEL_POS   3U           /**< Trigger selection (3 bits) */
+#define DAC_CR_TSEL_MSK   (0x7U << 3)
+#define DAC_CR_WAVE_POS   6U           /**< Wave generation (2 bits) */
+#define DAC_CR_WAVE_MSK   (0x3U << 6)
+#define DAC_CR_MAMP_POS   8U           /**< LFSR mask / triangle amplitude selector (4 bits) */
+#define DAC_CR_MAMP_MSK   (0xFU << 8)
+#define DAC_CR_DMAEN      (1U << 12)   /**< DMA request on trigger */
+#define DAC_CR_DMAUDRIE   (1U << 13)   /**< DMA underrun interrupt enable */
+/// @}
+
+/// @name DAC_SR Bit Flags
+/// @{
+#define DAC_SR_DMAUDR1    (1U << 13)   /**< Channel 1 DMA underrun (rc_w1) */
+#define DAC_SR_DMAUDR2    (1U << 29)   /**< Channel 2 DMA underrun (rc_w1) */
+/// @}
+
+/**
+ * @brief Register layout of the DAC.
+ */
+typedef struct {
+    volatile uint32_t CR;       /**< 0x00 Control register */
+    volatile uint32_t SWTRIGR;  /**< 0x04 Software trigger register */
+    volatile uint32_t DHR12R1;  /**< 0x08 Channel 1 12-bit right-aligned data holding register */
+    volatile uint32_t DHR12L1;  /**< 0x0C Channel 1 12-bit left-aligned data holding register */
+    volatile uint32_t DHR8R1;   /**< 0x10 Channel 1 8-bit right-aligned data holding register */
+    volatile uint32_t DHR12R2;  /**< 0x14 Channel 2 12-bit right-aligned data holding register */
+    volatile uint32_t DHR12L2;  /**< 0x18 Channel 2 12-bit left-aligned data holding register */
+    volatile uint32_t DHR8R2;   /**< 0x1C Channel 2 8-bit right-aligned data holding register */
+    volatile uint32_t DHR12RD;  /**< 0x20 Dual 12-bit right-aligned data holding register */
+    volatile uint32_t DHR12LD;  /**< 0x24 Dual 12-bit left-aligned data holding register */
+    volatile uint32_t DHR8RD;   /**< 0x28 Dual 8-bit right-aligned data holding register */
+    volatile uint32_t DOR1;     /**< 0x2C Channel 1 data output register */
+    volatile uint32_t DOR2;     /**< 0x30 Channel 2 data output register */
+    volatile uint32_t SR;       /**< 0x34 Status register */
+} DAC_TypeDef;
+
+/**
+ * @brief DAC output channel.
+ */
+typedef enum {
+    DAC_CHANNEL_1 = 1,   /**< OUT1, PA4 */
+    DAC_CHANNEL_2 = 2    /**< OUT2, PA5 */
+} dac_channel_t;
+
+/**
+ * @brief Conversion trigger (TSELx code).
+ *
+ * The DMA and the wave generator advance one step per TRGO.
+ */
+typedef enum {
+    DAC_TRIG_TIM6_TRGO = 0,   /**< TIM6 TRGO */
+    DAC_TRIG_TIM7_TRGO = 2    /**< TIM7 TRGO */
+} dac_trigger_t;
+
+/**
+ * @brief Built-in wave generator (WAVEx).
+ */
+typedef enum {
+    DAC_WAVE_NONE     = 0,    /**< Output DHRx only */
+    DAC_WAVE_NOISE    = 1,    /**< DHRx + LFSR pseudo-random noise */
+    DAC_WAVE_TRIANGLE = 2     /**< DHRx + up/down triangle counter */
+} dac_wave_t;
+
+#endif // STM32F4_DAC_H
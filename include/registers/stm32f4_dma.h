@@ -0,0 +1,112 @@
+/**
+ * @file stm32f4_dma.h
+ * @brief Register map and bit definitions for the DMA1/DMA2 controllers on STM32F446RE.
+ *
+ * Each DMA controller has 8 streams, and each stream can be connected to one of
+ * 8 peripheral request channels (CHSEL). The stream/channel pair for a given
+ * peripheral request is fixed by hardware (see RM0390, DMA1/DMA2 request mapping).
+ *
+ * This is a low-level, direct-register header with no runtime logic.
+ */
+
+#ifndef STM32F4_DMA_H
+#define STM32F4_DMA_H
+
+#include <stdint.h>
+
+/// @name DMA Base Addresses (AHB1 bus mapped)
+/// @{
+#define DMA1_BASE 0x40026000UL
+#define DMA2_BASE 0x40026400UL
+#define DMA1 ((DMA_TypeDef *) DMA1_BASE)  /**< DMA1 controller (peripheral requests on APB1) */
+#define DMA2 ((DMA_TypeDef *) DMA2_BASE)  /**< DMA2 controller (APB2 peripherals, memory-to-memory) */
+/// @}
+
+/// @name DMA_SxCR Bit Definitions
+/// @{
+#define DMA_SxCR_EN          (1U << 0)   /**< Stream enable (cleared by hardware at end of transfer) */
+#define DMA_SxCR_DMEIE       (1U << 1)   /**< Direct mode error interrupt enable */
+#define DMA_SxCR_TEIE        (1U << 2)   /**< Transfer error interrupt enable */
+#define DMA_SxCR_HTIE        (1U << 3)   /**< Half transfer interrupt enable */
+#define DMA_SxCR_TCIE        (1U << 4)   /**< Transfer complete interrupt enable */
+#define DMA_SxCR_PFCTRL      (1U << 5)   /**< Peripheral flow controller */
+#define DMA_SxCR_DIR_P2M     (0U << 6)   /**< Direction: peripheral to memory */
+#define DMA_SxCR_DIR_M2P     (1U << 6)   /**< Direction: memory to peripheral */
+#define DMA_SxCR_DIR_M2M     (2U << 6)   /**< Direction: memory to memory (DMA2 only) */
+#define DMA_SxCR_CIRC        (1U << 8)   /**< Circular mode */
+#define DMA_SxCR_PINC        (1U << 9)   /**< Peripheral address increment */
+#define DMA_SxCR_MINC        (1U << 10)  /**< Memory address increment */
+#define DMA_SxCR_PSIZE_8     (0U << 11)  /**< Peripheral data size: byte */
+#define DMA_SxCR_PSIZE_16    (1U << 11)  /**< Peripheral data size: half-word */
+#define DMA_SxCR_PSIZE_32    (2U << 11)  /**< Peripheral data size: word */
+#define DMA_SxCR_MSIZE_8     (0U << 13)  /**< Memory data size: byte */
+#define DMA_SxCR_MSIZE_16    (1U << 13)  /**< Memory data size: half-word */
+#define DMA_SxCR_MSIZE_32    (2U << 13)  /**< Memory data size: word */
+#define DMA_SxCR_PL_LOW      (0U << 16)  /**< Priority level: low */
+#define DMA_SxCR_PL_MEDIUM   (1U << 16)  /**< Priority level: medium */
+#define DMA_SxCR_PL_HIGH     (2U << 16)  /**< Priority level: high */
+#define DMA_SxCR_PL_VHIGH    (3U << 16)  /**< Priority level: very high */
+#define DMA_SxCR_DBM         (1U << 18)  /**< Double buffer mode */
+#define DMA_SxCR_CT          (1U << 19)  /**< Current target (0 = M0AR, 1 = M1AR) */
+#define DMA_SxCR_CHSEL(ch)   ((uint32_t)((ch) & 0x7U) << 25)  /**< Channel selection */
+/// @}
+
+/// @name DMA_SxFCR Bit Definitions
+/// @{
+#define DMA_SxFCR_FTH_FULL   (3U << 0)   /**< FIFO threshold: full */
+#define DMA_SxFCR_DMDIS      (1U << 2)   /**< Direct mode disable (use FIFO) */
+/// @}
+
+/**
+ * @name DMA Stream Interrupt Flags
+ *
+ * Flags are normalized to bit 0 of a stream's 6-bit field in LISR/HISR.
+ * Use `dma_stream_flags()` / `dma_stream_clear_flags()` to access them
+ * without computing per-stream shifts by hand.
+ * @{
+ */
+#define DMA_FLAG_FEIF        (1U << 0)   /**< FIFO error */
+#define DMA_FLAG_DMEIF       (1U << 2)   /**< Direct mode error */
+#define DMA_FLAG_TEIF        (1U << 3)   /**< Transfer error */
+#define DMA_FLAG_HTIF        (1U << 4)   /**< Half transfer complete */
+#define DMA_FLAG_TCIF        (1U << 5)   /**< Transfer complete */
+#define DMA_FLAG_ALL         (0x3DU)     /**< All stream flags */
+/// @}
+
+/**
+ * @brief Register layout of a single DMA stream.
+ */
+typedef struct {
+    volatile uint32_t CR;     /**< Stream configuration register */
+    volatile uint32_t NDTR;   /**< Number of data items to transfer */
+    volatile uint32_t PAR;    /**< Peripheral address register */
+    volatile uint32_t M0AR;   /**< Memory 0 address register */
+    volatile uint32_t M1AR;   /**< Memory 1 address register (double buffer mode) */
+    volatile uint32_t FCR;    /**< FIFO control register */
+} DMA_Stream_TypeDef;
+
+/**
+ * @brief Register layout of a DMA controller (DMA1 or DMA2).
+ *
+ * The eight streams follow the four interrupt status/clear registers.
+ */
+typedef struct {
+    volatile uint32_t LISR;           /**< Low interrupt status register (streams 0–3) */
+    volatile uint32_t HISR;           /**< High interrupt status register (streams 4–7) */
+    volatile uint32_t LIFCR;          /**< Low interrupt flag clear register (streams 0–3) */
+    volatile uint32_t HIFCR;          /**< High interrupt flag clear register (streams 4–7) */
+    DMA_Stream_TypeDef STREAM[8];     /**< Stream 0–7 registers */
+} DMA_TypeDef;
+
+/**
+ * @brief Fixed peripheral request mapping: which DMA, stream and channel serve a request.
+ *
+ * Example: USART2_TX is served by DMA1, stream 6, channel 4.
+ */
+typedef struct {
+    DMA_TypeDef *dma;   /**< DMA controller (DMA1 or DMA2) */
+    uint8_t stream;     /**< Stream number (0–7) */
+    uint8_t channel;    /**< Channel selection (0–7) */
+} dma_request_t;
+
+#endif // STM32F4_DMA_H
@@ -0,0 +1,49 @@
+/**
+ * @file stm32f4_dwt.h
+ * @brief DWT (Data Watchpoint and Trace) register definitions for Cortex-M4.
+ *
+ * Provides the DWT register layout used for the cycle counter, and the
+ * DEMCR register that gates the trace/DWT block.
+ */
+
+#ifndef STM32F4_DWT_H
+#define STM32F4_DWT_H
+
+#include <stdint.h>
+
+/**
+ * @brief DWT base address.
+ */
+#define DWT ((DWT_TypeDef *) 0xE0001000UL)
+
+/**
+ * @brief Debug Exception and Monitor Control Register (CoreDebug->DEMCR).
+ */
+#define DEMCR (*(volatile uint32_t *) 0xE000EDFCUL)
+
+/// @name DEMCR Bit Definitions
+/// @{
+#define DEMCR_TRCENA          (1U << 24)  /**< Enable DWT and ITM */
+/// @}
+
+/// @name DWT_CTRL Bit Definitions
+/// @{
+#define DWT_CTRL_CYCCNTENA    (1U << 0)   /**< Enable the cycle counter */
+#define DWT_CTRL_NOCYCCNT     (1U << 25)  /**< Cycle counter not implemented (read-only) */
+/// @}
+
+/**
+ * @brief Register layout of the DWT (counters only; comparators omitted).
+ */
+typedef struct {
+    volatile uint32_t CTRL;       /**< 0x00 Control register */
+    volatile uint32_t CYCCNT;     /**< 0x04 Cycle count register */
+    volatile uint32_t CPICNT;     /**< 0x08 CPI count register */
+    volatile uint32_t EXCCNT;     /**< 0x0C Exception overhead count register */
+    volatile uint32_t SLEEPCNT;   /**< 0x10 Sleep count register */
+    volatile uint32_t LSUCNT;     /**< 0x14 LSU count register */
+    volatile uint32_t FOLDCNT;    /**< 0x18 Folded-instruction count register */
+    volatile uint32_t PCSR;       /**< 0x1C Program counter sample register */
+} DWT_TypeDef;
+
+#endif // STM32F4_DWT_H
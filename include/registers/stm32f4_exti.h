@@ -0,0 +1,59 @@
+/**
+ * @file stm32f4_exti.h
+ * @brief EXTI and SYSCFG register definitions for STM32F446RE.
+ *
+ * EXTI lines 0–15 detect edges on GPIO pins; SYSCFG->EXTICR selects which
+ * port drives each line (one port per line number at a time).
+ */
+
+#ifndef STM32F4_EXTI_H
+#define STM32F4_EXTI_H
+
+#include <stdint.h>
+
+/// @name EXTI / SYSCFG Base Addresses (APB2)
+/// @{
+#define EXTI_BASE   0x40013C00UL
+#define SYSCFG_BASE 0x40013800UL
+#define EXTI   ((EXTI_TypeDef *) EXTI_BASE)      /**< External interrupt controller */
+#define SYSCFG ((SYSCFG_TypeDef *) SYSCFG_BASE)  /**< System configuration controller */
+/// @}
+
+/**
+ * @brief Number of GPIO EXTI lines.
+ */
+#define EXTI_GPIO_LINES 16U
+
+/**
+ * @brief Register layout of the EXTI controller.
+ */
+typedef struct {
+    volatile uint32_t IMR;     /**< 0x00 Interrupt mask register (1 = enabled) */
+    volatile uint32_t EMR;     /**< 0x04 Event mask register */
+    volatile uint32_t RTSR;    /**< 0x08 Rising trigger selection register */
+    volatile uint32_t FTSR;    /**< 0x0C Falling trigger selection register */
+    volatile uint32_t SWIER;   /**< 0x10 Software interrupt event register */
+    volatile uint32_t PR;      /**< 0x14 Pending register (write 1 to clear) */
+} EXTI_TypeDef;
+
+/**
+ * @brief Register layout of SYSCFG.
+ */
+typedef struct {
+    volatile uint32_t MEMRMP;     /**< 0x00 Memory remap register */
+    volatile uint32_t PMC;        /**< 0x04 Peripheral mode configuration register */
+    volatile uint32_t EXTICR[4];  /**< 0x08 External interrupt configuration registers (4 bits per line) */
+    uint32_t RESERVED0[2];        /**< 0x18 Reserved */
+    volatile uint32_t CMPCR;      /**< 0x20 Compensation cell control register */
+} SYSCFG_TypeDef;
+
+/**
+ * @brief Edge(s) that trigger an EXTI line.
+ */
+typedef enum {
+    EXTI_EDGE_RISING  = 0x01,  /**< Low-to-high transition */
+    EXTI_EDGE_FALLING = 0x02,  /**< High-to-low transition */
+    EXTI_EDGE_BOTH    = 0x03   /**< Either transition */
+} exti_edge_t;
+
+#endif // STM32F4_EXTI_H
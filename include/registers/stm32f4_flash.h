@@ -0,0 +1,44 @@
+/**
+ * @file stm32f4_flash.h
+ * @brief Flash interface register map for STM32F446RE.
+ *
+ * Only the access control register (ACR) is used by the HAL: it sets the
+ * number of wait states for the current HCLK and enables the ART accelerator
+ * (prefetch buffer plus instruction and data caches).
+ *
+ * This is a low-level, direct-register header with no runtime logic.
+ */
+
+#ifndef STM32F4_FLASH_H
+#define STM32F4_FLASH_H
+
+#include <stdint.h>
+
+/**
+ * @brief Flash interface base address.
+ */
+#define FLASH ((FLASH_TypeDef *) 0x40023C00UL)
+
+/// @name FLASH_ACR Bit Definitions
+/// @{
+#define FLASH_ACR_LATENCY_MSK  (0xFU << 0)  /**< Wait states field (0–15 WS) */
+#define FLASH_ACR_PRFTEN       (1U << 8)    /**< Prefetch enable */
+#define FLASH_ACR_ICEN         (1U << 9)    /**< Instruction cache enable */
+#define FLASH_ACR_DCEN         (1U << 10)   /**< Data cache enable */
+#define FLASH_ACR_ICRST        (1U << 11)   /**< Instruction cache reset (only while ICEN = 0) */
+#define FLASH_ACR_DCRST        (1U << 12)   /**< Data cache reset (only while DCEN = 0) */
+/// @}
+
+/**
+ * @brief Register layout of the flash interface.
+ */
+typedef struct {
+    volatile uint32_t ACR;      /**< Access control register */
+    volatile uint32_t KEYR;     /**< Key register */
+    volatile uint32_t OPTKEYR;  /**< Option key register */
+    volatile uint32_t SR;       /**< Status register */
+    volatile uint32_t CR;       /**< Control register */
+    volatile uint32_t OPTCR;    /**< Option control register */
+} FLASH_TypeDef;
+
+#endif // STM32F4_FLASH_H
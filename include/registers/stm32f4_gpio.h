@@ -16,16 +16,28 @@
 
 #include <stdint.h>
 
+/// @name GPIO Base Addresses (integer form, usable in constant expressions)
+/// @{
+#define GPIOA_BASE 0x40020000UL
+#define GPIOB_BASE 0x40020400UL
+#define GPIOC_BASE 0x40020800UL
+#define GPIOD_BASE 0x40020C00UL
+#define GPIOE_BASE 0x40021000UL
+#define GPIOF_BASE 0x40021400UL
+#define GPIOG_BASE 0x40021800UL
+#define GPIOH_BASE 0x40021C00UL
+/// @}
+
 /// @name GPIO Base Addresses (AHB1 bus mapped)
 /// @{
-#define GPIOA ((GPIO_TypeDef *) 0x40020000UL)
-#define GPIOB ((GPIO_TypeDef *) 0x40020400UL)
-#define GPIOC ((GPIO_TypeDef *) 0x40020800UL)
-#define GPIOD ((GPIO_TypeDef *) 0x40020C00UL)
-#define GPIOE ((GPIO_TypeDef *) 0x40021000UL)
-#define GPIOF ((GPIO_TypeDef *) 0x40021400UL)
-#define GPIOG ((GPIO_TypeDef *) 0x40021800UL)
-#define GPIOH ((GPIO_TypeDef *) 0x40021C00UL)
+#define GPIOA ((GPIO_TypeDef *) GPIOA_BASE)
+#define GPIOB ((GPIO_TypeDef *) GPIOB_BASE)
+#define GPIOC ((GPIO_TypeDef *) GPIOC_BASE)
+#define GPIOD ((GPIO_TypeDef *) GPIOD_BASE)
+#define GPIOE ((GPIO_TypeDef *) GPIOE_BASE)
+#define GPIOF ((GPIO_TypeDef *) GPIOF_BASE)
+#define GPIOG ((GPIO_TypeDef *) GPIOG_BASE)
+#define GPIOH ((GPIO_TypeDef *) GPIOH_BASE)
 /// @}
 
 /**
@@ -53,6 +65,11 @@
  */
 #define GET_PIN(p) ((p) & 0xFF)
 
+/**
+ * @brief Number of GPIO ports (A–H).
+ */
+#define GPIO_PORT_COUNT 8U
+
 /**
  * @brief Register map for STM32F4 GPIO peripheral.
  */
@@ -107,7 +124,7 @@ typedef enum {
 } gpio_pupdr_t;
 
 /**
- * @brief GPIO configuration structure used in gpio_init().
+ * @brief GPIO configuration structure used in gpio_init() and gpio_init_table().
  */
 typedef struct {
     uint16_t pin;            /**< Packed pin value: use PIN('A', 5) for PA5 */
@@ -115,6 +132,7 @@ typedef struct {
     gpio_type_t otype;       /**< Output type (push-pull/open-drain) */
     gpio_speed_t speed;      /**< Output speed (low/medium/high) */
     gpio_pupdr_t pull;       /**< Pull resistor config (none/up/down) */
+    uint8_t af;              /**< Alternate function 0–15 (used by gpio_init_table() in GPIO_MODE_ALTFUNC) */
 } gpio_config_t;
 
 /**
@@ -0,0 +1,97 @@
+/**
+ * @file stm32f4_i2c.h
+ * @brief Register definition for I2C peripheral on STM32F4 series.
+ *
+ * This header defines the memory-mapped base addresses, register layout and
+ * bit fields of the I2C1–I2C3 peripherals (standard mode up to 100 kHz, fast
+ * mode up to 400 kHz). Events and errors are reported on two separate
+ * interrupt lines per peripheral (`I2Cx_EV`, `I2Cx_ER`).
+ *
+ * The layout is based on RM0390 Reference Manual.
+ */
+
+#ifndef STM32F4_I2C_H
+#define STM32F4_I2C_H
+
+#include <stdint.h>
+
+/// @name I2C Base Addresses (integer form, usable in constant expressions)
+/// @{
+#define I2C1_BASE 0x40005400UL
+#define I2C2_BASE 0x40005800UL
+#define I2C3_BASE 0x40005C00UL
+/// @}
+
+/// @name I2C Base Addresses
+/// All three I2C peripherals are on APB1.
+/// @{
+#define I2C1 ((I2C_TypeDef *) I2C1_BASE)  /**< I2C1 base address (APB1) */
+#define I2C2 ((I2C_TypeDef *) I2C2_BASE)  /**< I2C2 base address (APB1) */
+#define I2C3 ((I2C_TypeDef *) I2C3_BASE)  /**< I2C3 base address (APB1) */
+/// @}
+
+/// @name I2C_CR1 Bit Definitions
+/// @{
+#define I2C_CR1_PE        (1U << 0)   /**< Peripheral enable */
+#define I2C_CR1_START     (1U << 8)   /**< Start (or repeated start) generation */
+#define I2C_CR1_STOP      (1U << 9)   /**< Stop generation */
+#define I2C_CR1_ACK       (1U << 10)  /**< Acknowledge received bytes */
+#define I2C_CR1_POS       (1U << 11)  /**< ACK/NACK applies to the next byte (2-byte reception) */
+#define I2C_CR1_SWRST     (1U << 15)  /**< Software reset */
+/// @}
+
+/// @name I2C_CR2 Bit Definitions
+/// @{
+#define I2C_CR2_FREQ_MSK  (0x3FU << 0) /**< Peripheral clock in MHz (2–50) */
+#define I2C_CR2_ITERREN   (1U << 8)   /**< Error interrupt enable */
+#define I2C_CR2_ITEVTEN   (1U << 9)   /**< Event interrupt enable (SB, ADDR, BTF, ...) */
+#define I2C_CR2_ITBUFEN   (1U << 10)  /**< Buffer interrupt enable (TXE, RXNE) */
+#define I2C_CR2_DMAEN     (1U << 11)  /**< DMA requests on TXE/RXNE */
+#define I2C_CR2_LAST      (1U << 12)  /**< Next DMA EOT is the last transfer: NACK it */
+/// @}
+
+/// @name I2C_SR1 Bit Flags
+/// @{
+#define I2C_SR1_SB        (1U << 0)   /**< Start condition generated */
+#define I2C_SR1_ADDR      (1U << 1)   /**< Address sent and acknowledged */
+#define I2C_SR1_BTF       (1U << 2)   /**< Byte transfer finished */
+#define I2C_SR1_RXNE      (1U << 6)   /**< Data register not empty */
+#define I2C_SR1_TXE       (1U << 7)   /**< Data register empty */
+#define I2C_SR1_BERR      (1U << 8)   /**< Bus error (misplaced start/stop) */
+#define I2C_SR1_ARLO      (1U << 9)   /**< Arbitration lost */
+#define I2C_SR1_AF        (1U << 10)  /**< Acknowledge failure (NACK) */
+#define I2C_SR1_OVR       (1U << 11)  /**< Overrun/underrun */
+#define I2C_SR1_TIMEOUT   (1U << 14)  /**< SCL held low for more than 25 ms */
+#define I2C_SR1_ERR_MSK   (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR | I2C_SR1_TIMEOUT)
+/// @}
+
+/// @name I2C_SR2 Bit Flags
+/// @{
+#define I2C_SR2_MSL       (1U << 0)   /**< Master mode */
+#define I2C_SR2_BUSY      (1U << 1)   /**< Bus busy */
+/// @}
+
+/// @name I2C_CCR Bit Definitions
+/// @{
+#define I2C_CCR_CCR_MSK   (0xFFFU << 0) /**< SCL period in PCLK1 cycles (see RM0390) */
+#define I2C_CCR_DUTY      (1U << 14)  /**< Fast mode duty: 0 = 2:1, 1 = 16:9 */
+#define I2C_CCR_FS        (1U << 15)  /**< Fast mode */
+/// @}
+
+/**
+ * @brief I2C register map.
+ */
+typedef struct {
+    volatile uint32_t CR1;    /**< 0x00 Control register 1 */
+    volatile uint32_t CR2;    /**< 0x04 Control register 2 */
+    volatile uint32_t OAR1;   /**< 0x08 Own address register 1 */
+    volatile uint32_t OAR2;   /**< 0x0C Own address register 2 */
+    volatile uint32_t DR;     /**< 0x10 Data register */
+    volatile uint32_t SR1;    /**< 0x14 Status register 1 */
+    volatile uint32_t SR2;    /**< 0x18 Status register 2 (reading it after SR1 clears ADDR) */
+    volatile uint32_t CCR;    /**< 0x1C Clock control register */
+    volatile uint32_t TRISE;  /**< 0x20 Maximum rise time in PCLK1 cycles + 1 */
+    volatile uint32_t FLTR;   /**< 0x24 Noise filter register */
+} I2C_TypeDef;
+
+#endif // STM32F4_I2C_H
@@ -0,0 +1,162 @@
+/**
+ * @file stm32f4_nvic.h
+ * @brief Register map of the Cortex-M4 NVIC and STM32F446RE interrupt numbers.
+ *
+ * The NVIC (Nested Vectored Interrupt Controller) is part of the Cortex-M core.
+ * Each device interrupt has an enable, pending and active bit spread across
+ * 32-bit register arrays (IRQn / 32 selects the word, IRQn % 32 the bit) and
+ * an 8-bit priority field of which the STM32F4 implements the upper 4 bits.
+ *
+ * This is a low-level, direct-register header with no runtime logic.
+ */
+
+#ifndef STM32F4_NVIC_H
+#define STM32F4_NVIC_H
+
+#include <stdint.h>
+
+/**
+ * @brief NVIC base address (System Control Space).
+ */
+#define NVIC ((NVIC_TypeDef *) 0xE000E100UL)
+
+/**
+ * @brief Register layout of the NVIC.
+ */
+typedef struct {
+    volatile uint32_t ISER[8];        /**< Interrupt set-enable registers */
+    uint32_t RESERVED0[24];
+    volatile uint32_t ICER[8];        /**< Interrupt clear-enable registers */
+    uint32_t RESERVED1[24];
+    volatile uint32_t ISPR[8];        /**< Interrupt set-pending registers */
+    uint32_t RESERVED2[24];
+    volatile uint32_t ICPR[8];        /**< Interrupt clear-pending registers */
+    uint32_t RESERVED3[24];
+    volatile uint32_t IABR[8];        /**< Interrupt active bit registers */
+    uint32_t RESERVED4[56];
+    volatile uint8_t  IP[240];        /**< Interrupt priority registers (upper 4 bits used) */
+    uint32_t RESERVED5[644];
+    volatile uint32_t STIR;           /**< Software trigger interrupt register */
+} NVIC_TypeDef;
+
+/**
+ * @brief Number of device interrupt lines on the STM32F446RE.
+ */
+#define NVIC_IRQ_COUNT      97U
+
+/**
+ * @brief Total vector table entries: initial SP + 15 core exceptions + device IRQs.
+ */
+#define NVIC_VECTOR_COUNT   (16U + NVIC_IRQ_COUNT)
+
+/**
+ * @brief Number of implemented priority bits (priority levels 0–15).
+ */
+#define NVIC_PRIO_BITS      4U
+
+/**
+ * @brief STM32F446RE interrupt numbers.
+ *
+ * Negative values are Cortex-M4 core exceptions (configured through the SCB),
+ * non-negative values are device interrupts (position in the vector table after
+ * the 16 core entries). Names match the `<name>_IRQHandler` symbols in
+ * `platform/stm32f4/startup.s`.
+ */
+typedef enum {
+    NonMaskableInt_IRQn     = -14,
+    MemoryManagement_IRQn   = -12,
+    BusFault_IRQn           = -11,
+    UsageFault_IRQn         = -10,
+    SVCall_IRQn             = -5,
+    DebugMonitor_IRQn       = -4,
+    PendSV_IRQn             = -2,
+    SysTick_IRQn            = -1,
+    WWDG_IRQn               = 0,
+    PVD_IRQn                = 1,
+    TAMP_STAMP_IRQn         = 2,
+    RTC_WKUP_IRQn           = 3,
+    FLASH_IRQn              = 4,
+    RCC_IRQn                = 5,
+    EXTI0_IRQn              = 6,
+    EXTI1_IRQn              = 7,
+    EXTI2_IRQn              = 8,
+    EXTI3_IRQn              = 9,
+    EXTI4_IRQn              = 10,
+    DMA1_Stream0_IRQn       = 11,
+    DMA1_Stream1_IRQn       = 12,
+    DMA1_Stream2_IRQn       = 13,
+    DMA1_Stream3_IRQn       = 14,
+    DMA1_Stream4_IRQn       = 15,
+    DMA1_Stream5_IRQn       = 16,
+    DMA1_Stream6_IRQn       = 17,
+    ADC_IRQn                = 18,
+    CAN1_TX_IRQn            = 19,
+    CAN1_RX0_IRQn           = 20,
+    CAN1_RX1_IRQn           = 21,
+    CAN1_SCE_IRQn           = 22,
+    EXTI9_5_IRQn            = 23,
+    TIM1_BRK_TIM9_IRQn      = 24,
+    TIM1_UP_TIM10_IRQn      = 25,
+    TIM1_TRG_COM_TIM11_IRQn = 26,
+    TIM1_CC_IRQn            = 27,
+    TIM2_IRQn               = 28,
+    TIM3_IRQn               = 29,
+    TIM4_IRQn               = 30,
+    I2C1_EV_IRQn            = 31,
+    I2C1_ER_IRQn            = 32,
+    I2C2_EV_IRQn            = 33,
+    I2C2_ER_IRQn            = 34,
+    SPI1_IRQn               = 35,
+    SPI2_IRQn               = 36,
+    USART1_IRQn             = 37,
+    USART2_IRQn             = 38,
+    USART3_IRQn             = 39,
+    EXTI15_10_IRQn          = 40,
+    RTC_Alarm_IRQn          = 41,
+    OTG_FS_WKUP_IRQn        = 42,
+    TIM8_BRK_TIM12_IRQn     = 43,
+    TIM8_UP_TIM13_IRQn      = 44,
+    TIM8_TRG_COM_TIM14_IRQn = 45,
+    TIM8_CC_IRQn            = 46,
+    DMA1_Stream7_IRQn       = 47,
+    FMC_IRQn                = 48,
+    SDIO_IRQn               = 49,
+    TIM5_IRQn               = 50,
+    SPI3_IRQn               = 51,
+    UART4_IRQn              = 52,
+    UART5_IRQn              = 53,
+    TIM6_DAC_IRQn           = 54,
+    TIM7_IRQn               = 55,
+    DMA2_Stream0_IRQn       = 56,
+    DMA2_Stream1_IRQn       = 57,
+    DMA2_Stream2_IRQn       = 58,
+    DMA2_Stream3_IRQn       = 59,
+    DMA2_Stream4_IRQn       = 60,
+    CAN2_TX_IRQn            = 63,
+    CAN2_RX0_IRQn           = 64,
+    CAN2_RX1_IRQn           = 65,
+    CAN2_SCE_IRQn           = 66,
+    OTG_FS_IRQn             = 67,
+    DMA2_Stream5_IRQn       = 68,
+    DMA2_Stream6_IRQn       = 69,
+    DMA2_Stream7_IRQn       = 70,
+    USART6_IRQn             = 71,
+    I2C3_EV_IRQn            = 72,
+    I2C3_ER_IRQn            = 73,
+    OTG_HS_EP1_OUT_IRQn     = 74,
+    OTG_HS_EP1_IN_IRQn      = 75,
+    OTG_HS_WKUP_IRQn        = 76,
+    OTG_HS_IRQn             = 77,
+    DCMI_IRQn               = 78,
+    FPU_IRQn                = 81,
+    SPI4_IRQn               = 84,
+    SAI1_IRQn               = 87,
+    SAI2_IRQn               = 91,
+    QUADSPI_IRQn            = 92,
+    HDMI_CEC_IRQn           = 93,
+    SPDIF_RX_IRQn           = 94,
+    FMPI2C1_EV_IRQn         = 95,
+    FMPI2C1_ER_IRQn         = 96
+} IRQn_Type;
+
+#endif // STM32F4_NVIC_H
@@ -0,0 +1,47 @@
+/**
+ * @file stm32f4_pwr.h
+ * @brief Power controller (PWR) register map for STM32F446RE.
+ *
+ * Used by the clock driver to select the regulator voltage scale and to
+ * enable over-drive, which is required for HCLK above 168 MHz (up to 180 MHz).
+ *
+ * This is a low-level, direct-register header with no runtime logic.
+ */
+
+#ifndef STM32F4_PWR_H
+#define STM32F4_PWR_H
+
+#include <stdint.h>
+
+/**
+ * @brief PWR base address (APB1).
+ */
+#define PWR_BASE 0x40007000UL
+#define PWR ((PWR_TypeDef *) PWR_BASE)
+
+/// @name PWR_CR Bit Definitions
+/// @{
+#define PWR_CR_VOS_SCALE3   (1U << 14)  /**< Regulator scale 3 (HCLK <= 120 MHz) */
+#define PWR_CR_VOS_SCALE2   (2U << 14)  /**< Regulator scale 2 (HCLK <= 144 MHz, 168 with over-drive) */
+#define PWR_CR_VOS_SCALE1   (3U << 14)  /**< Regulator scale 1 (HCLK <= 168 MHz, 180 with over-drive) */
+#define PWR_CR_VOS_MSK      (3U << 14)  /**< Regulator scale field */
+#define PWR_CR_ODEN         (1U << 16)  /**< Over-drive enable */
+#define PWR_CR_ODSWEN       (1U << 17)  /**< Over-drive switching enable */
+/// @}
+
+/// @name PWR_CSR Bit Flags
+/// @{
+#define PWR_CSR_VOSRDY      (1U << 14)  /**< Regulator voltage scaling output ready */
+#define PWR_CSR_ODRDY       (1U << 16)  /**< Over-drive mode ready */
+#define PWR_CSR_ODSWRDY     (1U << 17)  /**< Over-drive mode switching ready */
+/// @}
+
+/**
+ * @brief Register layout of the PWR peripheral.
+ */
+typedef struct {
+    volatile uint32_t CR;   /**< Power control register */
+    volatile uint32_t CSR;  /**< Power control/status register */
+} PWR_TypeDef;
+
+#endif // STM32F4_PWR_H
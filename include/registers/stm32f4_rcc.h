@@ -17,6 +17,49 @@
  */
 #define RCC ((RCC_TypeDef *) 0x40023800UL)
 
+/// @name RCC_CR Bit Definitions
+/// @{
+#define RCC_CR_HSION         (1U << 0)   /**< Internal 16 MHz RC oscillator enable */
+#define RCC_CR_HSIRDY        (1U << 1)   /**< HSI ready */
+#define RCC_CR_HSEON         (1U << 16)  /**< External oscillator enable */
+#define RCC_CR_HSERDY        (1U << 17)  /**< HSE ready */
+#define RCC_CR_HSEBYP        (1U << 18)  /**< HSE bypass (external clock instead of crystal) */
+#define RCC_CR_PLLON         (1U << 24)  /**< Main PLL enable */
+#define RCC_CR_PLLRDY        (1U << 25)  /**< Main PLL locked */
+/// @}
+
+/// @name RCC_PLLCFGR Field Positions
+/// @{
+#define RCC_PLLCFGR_PLLM_POS 0U          /**< Input divider M (2–63) */
+#define RCC_PLLCFGR_PLLN_POS 6U          /**< VCO multiplier N (50–432) */
+#define RCC_PLLCFGR_PLLP_POS 16U         /**< SYSCLK divider P (00 = /2 ... 11 = /8) */
+#define RCC_PLLCFGR_PLLSRC_HSE (1U << 22) /**< PLL input: 1 = HSE, 0 = HSI */
+#define RCC_PLLCFGR_PLLQ_POS 24U         /**< 48 MHz domain divider Q (2–15) */
+#define RCC_PLLCFGR_PLLR_POS 28U         /**< I2S/SAI/SYSCLK divider R (2–7) */
+/// @}
+
+/// @name RCC_CFGR Field Definitions
+/// @{
+#define RCC_CFGR_SW_MSK      (3U << 0)   /**< System clock switch */
+#define RCC_CFGR_SW_HSI      (0U << 0)   /**< SYSCLK = HSI */
+#define RCC_CFGR_SW_HSE      (1U << 0)   /**< SYSCLK = HSE */
+#define RCC_CFGR_SW_PLL      (2U << 0)   /**< SYSCLK = PLL_P */
+#define RCC_CFGR_SWS_POS     2U          /**< System clock switch status */
+#define RCC_CFGR_HPRE_POS    4U          /**< AHB prescaler (4 bits) */
+#define RCC_CFGR_PPRE1_POS   10U         /**< APB1 prescaler (3 bits) */
+#define RCC_CFGR_PPRE2_POS   13U         /**< APB2 prescaler (3 bits) */
+/// @}
+
+/// @name RCC_DCKCFGR Bit Definitions
+/// @{
+#define RCC_DCKCFGR_TIMPRE   (1U << 24)  /**< Timer clock prescaler selection */
+/// @}
+
+/// @name RCC_APB1ENR Bit Definitions
+/// @{
+#define RCC_APB1ENR_PWREN    (1U << 28)  /**< Power interface clock enable */
+/// @}
+
 /**
  * @brief RCC register layout as defined in STM32F4 reference manual (RM0090).
  */
@@ -57,4 +100,40 @@ typedef struct {
     volatile uint32_t DCKCFGR2;       /**< Dedicated clocks configuration register 2 */
 } RCC_TypeDef;
 
-#endif // STM32F4_RCC_H
\ No newline at end of file
+/**
+ * @brief Internal high-speed RC oscillator frequency in Hz.
+ */
+#define HSI_VALUE 16000000U
+
+/**
+ * @brief Default external oscillator frequency in Hz (Nucleo: 8 MHz MCO from the ST-Link).
+ */
+#ifndef HSE_VALUE
+#define HSE_VALUE 8000000U
+#endif
+
+/**
+ * @brief PLL input / system clock source selection.
+ */
+typedef enum {
+    RCC_SRC_HSI = 0x00,      /**< Internal 16 MHz RC oscillator */
+    RCC_SRC_HSE = 0x01       /**< External crystal or clock */
+} rcc_src_t;
+
+/**
+ * @brief Clock tree configuration used in rcc_clock_config().
+ *
+ * Set a divider to 0 to let the driver pick the smallest one that keeps the
+ * bus within its limit (APB1 <= 45 MHz, APB2 <= 90 MHz).
+ */
+typedef struct {
+    rcc_src_t source;        /**< Oscillator feeding the PLL (or SYSCLK directly) */
+    uint32_t hse_hz;         /**< HSE frequency in Hz (ignored for HSI; 0 = HSE_VALUE) */
+    uint8_t hse_bypass;      /**< 1 if HSE is an external clock signal rather than a crystal */
+    uint32_t sysclk_hz;      /**< Requested SYSCLK in Hz (up to 180000000) */
+    uint16_t ahb_div;        /**< AHB divider: 1, 2, 4, 8, 16, 64, 128, 256, 512 (0 = 1) */
+    uint8_t apb1_div;        /**< APB1 divider: 1, 2, 4, 8, 16 (0 = auto) */
+    uint8_t apb2_div;        /**< APB2 divider: 1, 2, 4, 8, 16 (0 = auto) */
+} rcc_clock_config_t;
+
+#endif // STM32F4_RCC_H
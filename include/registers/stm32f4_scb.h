@@ -0,0 +1,81 @@
+/**
+ * @file stm32f4_scb.h
+ * @brief Register map of the Cortex-M4 System Control Block (SCB).
+ *
+ * The SCB holds core configuration: vector table offset (VTOR), priority
+ * grouping (AIRCR), core exception priorities (SHP), fault status, and the
+ * coprocessor access control register (CPACR) used to enable the FPU.
+ *
+ * This is a low-level, direct-register header with no runtime logic.
+ */
+
+#ifndef STM32F4_SCB_H
+#define STM32F4_SCB_H
+
+#include <stdint.h>
+
+/**
+ * @brief SCB base address (System Control Space).
+ */
+#define SCB ((SCB_TypeDef *) 0xE000ED00UL)
+
+/// @name SCB_ICSR Bit Definitions
+/// @{
+#define SCB_ICSR_PENDSTCLR    (1U << 25)  /**< Clear pending SysTick */
+#define SCB_ICSR_PENDSTSET    (1U << 26)  /**< SysTick exception pending */
+#define SCB_ICSR_PENDSVSET    (1U << 28)  /**< Set pending PendSV */
+/// @}
+
+/// @name SCB_AIRCR Bit Definitions
+/// @{
+#define SCB_AIRCR_VECTKEY     (0x05FAU << 16)  /**< Write key, required for any AIRCR write */
+#define SCB_AIRCR_PRIGROUP_POS 8U              /**< Priority grouping field position */
+#define SCB_AIRCR_PRIGROUP_MSK (0x7U << 8)     /**< Priority grouping field mask */
+#define SCB_AIRCR_SYSRESETREQ (1U << 2)        /**< Request a system reset */
+/// @}
+
+/// @name SCB_CPACR Bit Definitions
+/// @{
+#define SCB_CPACR_CP10_FULL   (3U << 20)  /**< Full access to CP10 (FPU) */
+#define SCB_CPACR_CP11_FULL   (3U << 22)  /**< Full access to CP11 (FPU) */
+/// @}
+
+/**
+ * @brief FPU context control register (FPCCR), outside the SCB block.
+ */
+#define FPU_FPCCR (*(volatile uint32_t *) 0xE000EF34UL)
+
+/// @name FPU_FPCCR Bit Definitions
+/// @{
+#define FPU_FPCCR_LSPEN       (1U << 30)  /**< Lazy state preservation: reserve FP frame, push only if used */
+#define FPU_FPCCR_ASPEN       (1U << 31)  /**< Automatically set CONTROL.FPCA on FP instruction execution */
+/// @}
+
+/**
+ * @brief Register layout of the SCB.
+ */
+typedef struct {
+    volatile uint32_t CPUID;      /**< 0x00 CPUID base register */
+    volatile uint32_t ICSR;       /**< 0x04 Interrupt control and state register */
+    volatile uint32_t VTOR;       /**< 0x08 Vector table offset register */
+    volatile uint32_t AIRCR;      /**< 0x0C Application interrupt and reset control register */
+    volatile uint32_t SCR;        /**< 0x10 System control register */
+    volatile uint32_t CCR;        /**< 0x14 Configuration and control register */
+    volatile uint8_t  SHP[12];    /**< 0x18 System handler priority registers (exceptions 4–15) */
+    volatile uint32_t SHCSR;      /**< 0x24 System handler control and state register */
+    volatile uint32_t CFSR;       /**< 0x28 Configurable fault status register */
+    volatile uint32_t HFSR;       /**< 0x2C HardFault status register */
+    volatile uint32_t DFSR;       /**< 0x30 Debug fault status register */
+    volatile uint32_t MMFAR;      /**< 0x34 MemManage fault address register */
+    volatile uint32_t BFAR;       /**< 0x38 BusFault address register */
+    volatile uint32_t AFSR;       /**< 0x3C Auxiliary fault status register */
+    volatile uint32_t PFR[2];     /**< 0x40 Processor feature registers */
+    volatile uint32_t DFR;        /**< 0x48 Debug feature register */
+    volatile uint32_t ADR;        /**< 0x4C Auxiliary feature register */
+    volatile uint32_t MMFR[4];    /**< 0x50 Memory model feature registers */
+    volatile uint32_t ISAR[5];    /**< 0x60 Instruction set attributes registers */
+    uint32_t RESERVED0[5];        /**< 0x74 Reserved */
+    volatile uint32_t CPACR;      /**< 0x88 Coprocessor access control register */
+} SCB_TypeDef;
+
+#endif // STM32F4_SCB_H
@@ -14,13 +14,48 @@
 
 #include <stdint.h>
 
+/// @name SPI Base Addresses (integer form, usable in constant expressions)
+/// @{
+#define SPI1_BASE 0x40013000UL
+#define SPI2_BASE 0x40003800UL
+#define SPI3_BASE 0x40003C00UL
+#define SPI4_BASE 0x40013400UL
+/// @}
+
 /// @name SPI Base Addresses
 /// STM32F4 SPI peripherals are on APB1 or APB2 buses.
 /// @{
-#define SPI1 ((SPI_TypeDef *) 0x40013000UL)  /**< SPI1 base address (APB2) */
-#define SPI2 ((SPI_TypeDef *) 0x40003800UL)  /**< SPI2 base address (APB1) */
-#define SPI3 ((SPI_TypeDef *) 0x40003C00UL)  /**< SPI3 base address (APB1) */
-#define SPI4 ((SPI_TypeDef *) 0x40013400UL)  /**< SPI4 base address (APB2) */
+#define SPI1 ((SPI_TypeDef *) SPI1_BASE)  /**< SPI1 base address (APB2) */
+#define SPI2 ((SPI_TypeDef *) SPI2_BASE)  /**< SPI2 base address (APB1) */
+#define SPI3 ((SPI_TypeDef *) SPI3_BASE)  /**< SPI3 base address (APB1) */
+#define SPI4 ((SPI_TypeDef *) SPI4_BASE)  /**< SPI4 base address (APB2) */
+/// @}
+
+/// @name SPI_CR1 Bit Definitions
+/// @{
+#define SPI_CR1_CPHA      (1U << 0)   /**< Clock phase */
+#define SPI_CR1_CPOL      (1U << 1)   /**< Clock polarity */
+#define SPI_CR1_MSTR      (1U << 2)   /**< Master selection */
+#define SPI_CR1_BR_POS    3U          /**< Baud rate prescaler field position (3 bits) */
+#define SPI_CR1_SPE       (1U << 6)   /**< SPI enable */
+#define SPI_CR1_LSBFIRST  (1U << 7)   /**< Frame format: LSB first */
+#define SPI_CR1_SSI       (1U << 8)   /**< Internal slave select */
+#define SPI_CR1_SSM       (1U << 9)   /**< Software slave management */
+#define SPI_CR1_DFF       (1U << 11)  /**< Data frame format: 16-bit */
+/// @}
+
+/// @name SPI_CR2 Bit Definitions
+/// @{
+#define SPI_CR2_RXDMAEN   (1U << 0)   /**< RX buffer DMA enable */
+#define SPI_CR2_TXDMAEN   (1U << 1)   /**< TX buffer DMA enable */
+/// @}
+
+/// @name SPI_SR Bit Flags
+/// @{
+#define SPI_SR_RXNE       (1U << 0)   /**< Receive buffer not empty */
+#define SPI_SR_TXE        (1U << 1)   /**< Transmit buffer empty */
+#define SPI_SR_OVR        (1U << 6)   /**< Overrun flag */
+#define SPI_SR_BSY        (1U << 7)   /**< Busy flag */
 /// @}
 
 /**
@@ -71,4 +106,40 @@ typedef struct
                                  */
 } SPI_TypeDef;
 
+/**
+ * @brief SPI clock mode (CPOL/CPHA combination).
+ */
+typedef enum {
+    SPI_MODE_0 = 0x00,   /**< CPOL = 0, CPHA = 0: idle low, sample on rising edge */
+    SPI_MODE_1 = 0x01,   /**< CPOL = 0, CPHA = 1: idle low, sample on falling edge */
+    SPI_MODE_2 = 0x02,   /**< CPOL = 1, CPHA = 0: idle high, sample on falling edge */
+    SPI_MODE_3 = 0x03    /**< CPOL = 1, CPHA = 1: idle high, sample on rising edge */
+} spi_mode_t;
+
+/**
+ * @brief SPI data frame size (CR1.DFF).
+ */
+typedef enum {
+    SPI_FRAME_8BIT  = 0x00,  /**< 8-bit frames */
+    SPI_FRAME_16BIT = 0x01   /**< 16-bit frames */
+} spi_frame_t;
+
+/**
+ * @brief SPI bit order (CR1.LSBFIRST).
+ */
+typedef enum {
+    SPI_MSB_FIRST = 0x00,    /**< Most significant bit first */
+    SPI_LSB_FIRST = 0x01     /**< Least significant bit first */
+} spi_bit_order_t;
+
+/**
+ * @brief SPI master configuration structure used in spi_init_config().
+ */
+typedef struct {
+    spi_mode_t mode;             /**< Clock polarity/phase */
+    spi_frame_t frame;           /**< 8- or 16-bit frames */
+    spi_bit_order_t bit_order;   /**< MSB or LSB first */
+    uint32_t max_hz;             /**< Highest allowed SCK frequency in Hz */
+} spi_config_t;
+
 #endif // STM32F4_SPI_H
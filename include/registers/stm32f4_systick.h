@@ -37,6 +37,7 @@
 /// @name SysTick Control Register Bit Masks
 /// @{
 #define CTRL_ENABLE     (1U << 0)   /**< Enables the counter */
+#define CTRL_TICKINT    (1U << 1)   /**< Raise the SysTick exception when the counter reaches 0 */
 #define CTRL_CLKSOURCE  (1U << 2)   /**< Clock source: 1 = processor clock, 0 = external */
 #define CTRL_COUNTFLAG  (1U << 16)  /**< Set to 1 when timer counts to 0 (auto-clears on read) */
 /// @}
@@ -22,25 +22,43 @@
 
 #include <stdint.h>
 
+/// @name TIM Base Addresses (integer form, usable in constant expressions)
+/// @{
+#define TIM1_BASE  0x40010000UL
+#define TIM8_BASE  0x40010400UL
+#define TIM9_BASE  0x40014000UL
+#define TIM10_BASE 0x40014400UL
+#define TIM11_BASE 0x40014800UL
+#define TIM2_BASE  0x40000000UL
+#define TIM3_BASE  0x40000400UL
+#define TIM4_BASE  0x40000800UL
+#define TIM5_BASE  0x40000C00UL
+#define TIM6_BASE  0x40001000UL
+#define TIM7_BASE  0x40001400UL
+#define TIM12_BASE 0x40001800UL
+#define TIM13_BASE 0x40001C00UL
+#define TIM14_BASE 0x40002000UL
+/// @}
+
 /** @defgroup TIM_BaseAddresses Timer Peripheral Base Addresses
  *  @brief Memory-mapped base addresses for STM32F446RE TIM peripherals.
  *  @{
  */
-#define TIM1   ((TIM_TypeDef *) 0x40010000UL) /**< APB2: Advanced timer */
-#define TIM8   ((TIM_TypeDef *) 0x40010400UL)
-#define TIM9   ((TIM_TypeDef *) 0x40014000UL)
-#define TIM10  ((TIM_TypeDef *) 0x40014400UL)
-#define TIM11  ((TIM_TypeDef *) 0x40014800UL)
-
-#define TIM2   ((TIM_TypeDef *) 0x40000000UL) /**< APB1: General-purpose */
-#define TIM3   ((TIM_TypeDef *) 0x40000400UL)
-#define TIM4   ((TIM_TypeDef *) 0x40000800UL)
-#define TIM5   ((TIM_TypeDef *) 0x40000C00UL)
-#define TIM6   ((TIM_TypeDef *) 0x40001000UL) /**< Basic timer (no CCRx) */
-#define TIM7   ((TIM_TypeDef *) 0x40001400UL)
-#define TIM12  ((TIM_TypeDef *) 0x40001800UL)
-#define TIM13  ((TIM_TypeDef *) 0x40001C00UL)
-#define TIM14  ((TIM_TypeDef *) 0x40002000UL)
+#define TIM1   ((TIM_TypeDef *) TIM1_BASE) /**< APB2: Advanced timer */
+#define TIM8   ((TIM_TypeDef *) TIM8_BASE)
+#define TIM9   ((TIM_TypeDef *) TIM9_BASE)
+#define TIM10  ((TIM_TypeDef *) TIM10_BASE)
+#define TIM11  ((TIM_TypeDef *) TIM11_BASE)
+
+#define TIM2   ((TIM_TypeDef *) TIM2_BASE) /**< APB1: General-purpose */
+#define TIM3   ((TIM_TypeDef *) TIM3_BASE)
+#define TIM4   ((TIM_TypeDef *) TIM4_BASE)
+#define TIM5   ((TIM_TypeDef *) TIM5_BASE)
+#define TIM6   ((TIM_TypeDef *) TIM6_BASE) /**< Basic timer (no CCRx) */
+#define TIM7   ((TIM_TypeDef *) TIM7_BASE)
+#define TIM12  ((TIM_TypeDef *) TIM12_BASE)
+#define TIM13  ((TIM_TypeDef *) TIM13_BASE)
+#define TIM14  ((TIM_TypeDef *) TIM14_BASE)
 /** @} */
 
 /** @defgroup TIM_CR_BitDefinitions Timer Register Bit Masks
@@ -48,7 +66,16 @@
  *  @{
  */
 #define TIM_CR1_CEN         (1U << 0)  /**< Counter enable */
+#define TIM_CR1_CEN_POS     0U         /**< Counter enable bit position */
+#define TIM_CR1_UDIS        (1U << 1)  /**< Update disable: shadow registers keep their value */
+#define TIM_CR1_UDIS_POS    1U         /**< Update disable bit position */
+#define TIM_CR1_URS         (1U << 2)  /**< Update request source: only over/underflow raises UIF */
+#define TIM_CR1_URS_POS     2U         /**< Update request source bit position */
+#define TIM_CR1_DIR         (1U << 4)  /**< Direction: downcounting */
+#define TIM_CR1_CMS_POS     5U         /**< Center-aligned mode selection field position (2 bits) */
+#define TIM_CR1_CMS_MSK     (0x3U << 5)
 #define TIM_CR1_ARPE        (1U << 7)  /**< Auto-reload preload enable */
+#define TIM_CR1_ARPE_POS    7U         /**< Auto-reload preload enable bit position */
 
 #define TIM_EGR_UG          (1U << 0)  /**< Update generation */
 
@@ -59,8 +86,83 @@
 
 #define TIM_CCMR1_OC1M_PWM1 (0x6 << 4) /**< PWM Mode 1 for CH1 */
 #define TIM_CCMR1_OC1PE     (1U << 3)  /**< Output Compare 1 preload enable */
+#define TIM_CCMR_OCM_POS    4U         /**< Output compare mode field position in a channel byte (3 bits) */
+#define TIM_CCMR_OCM_MSK    (0x7U << 4)
 /** @} */
 
+/// @name TIM_CCER Complementary Output Bits (channel 1; add 4 per channel, CH1–CH3 only)
+/// @{
+#define TIM_CCER_CC1NE      (1U << 2)  /**< Complementary output enable (TIM1/TIM8) */
+/// @}
+
+/// @name TIM_BDTR Bit Definitions (TIM1/TIM8)
+/// @{
+#define TIM_BDTR_DTG_MSK    0xFFU        /**< Dead-time generator setup */
+#define TIM_BDTR_OSSI       (1U << 10)   /**< Off-state selection for idle mode */
+#define TIM_BDTR_OSSR       (1U << 11)   /**< Off-state selection for run mode */
+#define TIM_BDTR_BKE        (1U << 12)   /**< Break input enable */
+#define TIM_BDTR_BKP        (1U << 13)   /**< Break polarity: active high */
+#define TIM_BDTR_AOE        (1U << 14)   /**< Automatic output enable after break */
+#define TIM_BDTR_MOE        (1U << 15)   /**< Main output enable */
+#define TIM_BDTR_MOE_POS    15U          /**< Main output enable bit position */
+/// @}
+
+/// @name TIM_CCMRx Input Capture Fields
+/// Per-channel byte: CH1/CH3 at bits 0–7, CH2/CH4 at bits 8–15 of CCMR1/CCMR2.
+/// @{
+#define TIM_CCMR_CCS_MSK        0x3U  /**< Capture/compare selection mask */
+#define TIM_CCMR_CCS_DIRECT     0x1U  /**< Input, mapped on own pin (TI1 for CH1, TI2 for CH2, ...) */
+#define TIM_CCMR_CCS_INDIRECT   0x2U  /**< Input, mapped on the paired pin (TI2 for CH1, TI1 for CH2, ...) */
+#define TIM_CCMR_ICPSC_POS      2U    /**< Input capture prescaler field position (2 bits) */
+#define TIM_CCMR_ICF_POS        4U    /**< Input capture filter field position (4 bits) */
+/// @}
+
+/// @name TIM_CCER Polarity Bits (channel 1; add 4 per channel)
+/// @{
+#define TIM_CCER_CC1P       (1U << 1)  /**< Capture on falling edge / output active low */
+#define TIM_CCER_CC1NP      (1U << 3)  /**< With CC1P: capture on both edges */
+/// @}
+
+/// @name TIM_CR2 Bit Definitions
+/// @{
+#define TIM_CR2_MMS_MSK     (0x7U << 4)  /**< Master mode selection mask */
+#define TIM_CR2_MMS_UPDATE  (0x2U << 4)  /**< TRGO = update event */
+/// @}
+
+/// @name TIM_SMCR Bit Definitions
+/// @{
+#define TIM_SMCR_SMS_MSK    (0x7U << 0)  /**< Slave mode selection mask */
+#define TIM_SMCR_SMS_RESET  (0x4U << 0)  /**< Reset mode: trigger re-initializes the counter */
+#define TIM_SMCR_SMS_ENC1   (0x1U << 0)  /**< Encoder mode 1: count on TI2 edges */
+#define TIM_SMCR_SMS_ENC2   (0x2U << 0)  /**< Encoder mode 2: count on TI1 edges */
+#define TIM_SMCR_SMS_ENC3   (0x3U << 0)  /**< Encoder mode 3: count on TI1 and TI2 edges */
+#define TIM_SMCR_SMS_EXT1   (0x7U << 0)  /**< External clock mode 1: count trigger (TRGI) edges */
+#define TIM_SMCR_TS_ITR0    (0x0U << 4)  /**< Trigger: internal trigger 0 (TIM5: TIM2 TRGO) */
+#define TIM_SMCR_TS_MSK     (0x7U << 4)  /**< Trigger selection mask */
+#define TIM_SMCR_TS_TI1FP1  (0x5U << 4)  /**< Trigger: filtered timer input 1 */
+#define TIM_SMCR_TS_TI2FP2  (0x6U << 4)  /**< Trigger: filtered timer input 2 */
+/// @}
+
+/// @name TIM_DCR Bit Definitions
+/// @{
+#define TIM_DCR_DBA_POS     0U         /**< DMA base address: word offset from CR1 (5 bits) */
+#define TIM_DCR_DBL_POS     8U         /**< DMA burst length minus one (5 bits) */
+/// @}
+
+/// @name TIM_DIER / TIM_SR Bit Definitions (channel 1; add 1 per channel)
+/// @{
+#define TIM_DIER_UIE        (1U << 0)  /**< Update interrupt enable */
+#define TIM_DIER_UIE_POS    0U         /**< Update interrupt enable bit position */
+#define TIM_DIER_CC1IE      (1U << 1)  /**< Capture/compare 1 interrupt enable */
+#define TIM_DIER_UDE        (1U << 8)  /**< Update DMA request enable */
+#define TIM_DIER_UDE_POS    8U         /**< Update DMA request enable bit position */
+#define TIM_DIER_CC1DE      (1U << 9)  /**< Capture/compare 1 DMA request enable */
+#define TIM_DIER_CC1DE_POS  9U         /**< Capture/compare 1 DMA request enable bit position */
+#define TIM_SR_UIF          (1U << 0)  /**< Update interrupt flag (rc_w0) */
+#define TIM_SR_CC1IF        (1U << 1)  /**< Capture/compare 1 flag (rc_w0, cleared by reading CCR1) */
+#define TIM_SR_CC1OF        (1U << 9)  /**< Capture 1 overcapture flag (rc_w0) */
+/// @}
+
 /**
  * @brief TIMx register map structure.
  *
@@ -90,4 +192,92 @@ typedef struct {
     volatile uint32_t DMAR;    /**< DMA Address for Full Transfer */
 } TIM_TypeDef;
 
+/**
+ * @brief PWM output compare mode (OCxM).
+ */
+typedef enum {
+    TIM_PWM_MODE1 = 0x6,     /**< Active while CNT < CCRx (upcounting) */
+    TIM_PWM_MODE2 = 0x7      /**< Inactive while CNT < CCRx (upcounting) */
+} tim_pwm_mode_t;
+
+/**
+ * @brief Counter alignment (CR1.CMS).
+ *
+ * In the center-aligned modes the counter runs up to ARR and back down, so
+ * the PWM period is 2 × ARR ticks and all channels are centered on the
+ * underflow. The modes differ in which direction sets the compare flags.
+ */
+typedef enum {
+    TIM_COUNT_EDGE    = 0x0, /**< Edge-aligned, up/down per DIR */
+    TIM_COUNT_CENTER1 = 0x1, /**< Center-aligned, flags set counting down */
+    TIM_COUNT_CENTER2 = 0x2, /**< Center-aligned, flags set counting up */
+    TIM_COUNT_CENTER3 = 0x3  /**< Center-aligned, flags set both ways */
+} tim_count_mode_t;
+
+/**
+ * @brief Playback mode of a DMA burst stream (tim_burst_start()).
+ */
+typedef enum {
+    TIM_BURST_ONESHOT  = 0,  /**< Play the buffer once, then stop */
+    TIM_BURST_CIRCULAR = 1,  /**< Loop one buffer; callback at each half so the other half can be refilled */
+    TIM_BURST_DOUBLE   = 2   /**< Alternate two buffers; callback when one finishes and is free */
+} tim_burst_mode_t;
+
+/**
+ * @brief Dead-time and break configuration used in tim_pwm_bdtr_config() (TIM1/TIM8).
+ */
+typedef struct {
+    uint32_t deadtime_ns;    /**< Delay inserted between CHx and CHxN switching, in ns */
+    uint8_t break_enable;    /**< 1 = BKIN pin forces outputs to their idle state */
+    uint8_t break_high;      /**< 1 = break active high, 0 = active low */
+    uint8_t auto_restart;    /**< 1 = MOE set again at the next update after break clears (AOE) */
+} tim_bdtr_config_t;
+
+/**
+ * @brief Quadrature decoding resolution (SMCR.SMS encoder modes).
+ */
+typedef enum {
+    TIM_ENCODER_X2_TI1 = 0x2,  /**< Count both edges of TI1 (2 counts per cycle) */
+    TIM_ENCODER_X2_TI2 = 0x1,  /**< Count both edges of TI2 (2 counts per cycle) */
+    TIM_ENCODER_X4     = 0x3   /**< Count every edge of TI1 and TI2 (4 counts per cycle) */
+} tim_encoder_mode_t;
+
+/**
+ * @brief Encoder interface configuration used in tim_encoder_init().
+ */
+typedef struct {
+    tim_encoder_mode_t mode;   /**< x2 or x4 decoding */
+    uint8_t filter;            /**< ICxF filter code 0–15 on both inputs */
+    uint8_t invert;            /**< 1 = invert TI1 so the count direction is reversed */
+} tim_encoder_config_t;
+
+/**
+ * @brief Input capture edge, encoded as the channel 1 CCER polarity bits.
+ */
+typedef enum {
+    TIM_IC_RISING  = 0x00,                              /**< Capture on rising edge */
+    TIM_IC_FALLING = TIM_CCER_CC1P,                     /**< Capture on falling edge */
+    TIM_IC_BOTH    = TIM_CCER_CC1P | TIM_CCER_CC1NP     /**< Capture on both edges */
+} tim_ic_edge_t;
+
+/**
+ * @brief Input capture channel configuration used in tim_ic_config_channel().
+ */
+typedef struct {
+    uint8_t channel;         /**< Channel 1–4 (captures its own pin, TIx) */
+    tim_ic_edge_t edge;      /**< Edge(s) that latch CNT into CCRx */
+    uint8_t prescaler;       /**< Capture every 2^n-th edge: 0 = every edge ... 3 = every 8th */
+    uint8_t filter;          /**< ICxF digital filter code 0–15 (0 = none, higher = longer) */
+} tim_ic_config_t;
+
+/**
+ * @brief Signal measurement computed by tim_ic_measure().
+ */
+typedef struct {
+    uint32_t period;         /**< Mean period in timer ticks */
+    uint32_t width;          /**< Mean pulse width in timer ticks (0 without a width channel) */
+    uint32_t freq_hz;        /**< Frequency in Hz, rounded */
+    uint16_t duty_permille;  /**< Duty cycle 0–1000 (0 without a width channel) */
+} tim_ic_measure_t;
+
 #endif // STM32F4_TIM_H
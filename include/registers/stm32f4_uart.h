@@ -14,27 +14,48 @@
 
 #include <stdint.h>
 
+/// @name UART Base Addresses (integer form, usable in constant expressions)
+/// @{
+#define USART1_BASE 0x40011000UL
+#define USART2_BASE 0x40004400UL
+#define USART3_BASE 0x40004800UL
+#define UART4_BASE  0x40004C00UL
+#define UART5_BASE  0x40005000UL
+#define USART6_BASE 0x40011400UL
+/// @}
+
 /// @name UART Base Addresses
 /// These addresses correspond to USART peripherals supported on STM32F411RE.
 /// @{
-#define USART1 ((UART_TypeDef *) 0x40011000UL)  /**< High-speed USART (APB2) */
-#define USART2 ((UART_TypeDef *) 0x40004400UL)  /**< General-purpose USART (APB1) */
-#define USART3 ((UART_TypeDef *) 0x40004800UL)  /**< General-purpose USART (APB1) */
-#define UART4  ((UART_TypeDef *) 0x40004C00UL)  /**< UART-only peripheral (APB1) */
-#define UART5  ((UART_TypeDef *) 0x40005000UL)  /**< UART-only peripheral (APB1) */
-#define USART6 ((UART_TypeDef *) 0x40011400UL)  /**< High-speed USART (APB2) */
+#define USART1 ((UART_TypeDef *) USART1_BASE)  /**< High-speed USART (APB2) */
+#define USART2 ((UART_TypeDef *) USART2_BASE)  /**< General-purpose USART (APB1) */
+#define USART3 ((UART_TypeDef *) USART3_BASE)  /**< General-purpose USART (APB1) */
+#define UART4  ((UART_TypeDef *) UART4_BASE)  /**< UART-only peripheral (APB1) */
+#define UART5  ((UART_TypeDef *) UART5_BASE)  /**< UART-only peripheral (APB1) */
+#define USART6 ((UART_TypeDef *) USART6_BASE)  /**< High-speed USART (APB2) */
 /// @}
 
 /// @name USART_CR1 Bit Definitions
 /// @{
-#define USART_CR1_RE   (1 << 2)   /**< Receiver enable */
-#define USART_CR1_TE   (1 << 3)   /**< Transmitter enable */
-#define USART_CR1_UE   (1 << 13)  /**< USART enable */
+#define USART_CR1_RE     (1 << 2)   /**< Receiver enable */
+#define USART_CR1_TE     (1 << 3)   /**< Transmitter enable */
+#define USART_CR1_IDLEIE (1 << 4)   /**< IDLE line interrupt enable */
+#define USART_CR1_RXNEIE (1 << 5)   /**< RXNE (and overrun) interrupt enable */
+#define USART_CR1_UE     (1 << 13)  /**< USART enable */
+/// @}
+
+/// @name USART_CR3 Bit Definitions
+/// @{
+#define USART_CR3_DMAR (1 << 6)   /**< DMA enable receiver */
+#define USART_CR3_DMAT (1 << 7)   /**< DMA enable transmitter */
 /// @}
 
 /// @name USART_SR Bit Flags
 /// @{
+#define USART_SR_ORE   (1 << 3)   /**< Overrun error */
+#define USART_SR_IDLE  (1 << 4)   /**< Idle line detected */
 #define USART_SR_RXNE  (1 << 5)   /**< Receive data register not empty */
+#define USART_SR_TC    (1 << 6)   /**< Transmission complete */
 #define USART_SR_TXE   (1 << 7)   /**< Transmit data register empty */
 /// @}
 
@@ -8,13 +8,14 @@
 .section .isr_vector, "a", %progbits
 .global _vector_table
 .type _vector_table, %object
-.size _vector_table, . - _vector_table
 
 /* 
  * @brief Interrupt vector table for Cortex-M4
  * The first entry is the initial stack pointer value.
  * The second entry is the address of Reset_Handler().
- * All other entries are exception/IRQ handlers.
+ * All other entries are exception/IRQ handlers. Device IRQ handlers are weak
+ * and can be overridden by defining a C function with the same name
+ * (e.g. `void USART2_IRQHandler(void)`).
  */
 _vector_table:
     .word _estack            /* Initial stack pointer (top of SRAM) */
@@ -34,6 +35,107 @@ _vector_table:
     .word PendSV
     .word SysTick_Handler
 
+    /* External interrupts (IRQn = index in comment), RM0390 vector table */
+    .word WWDG_IRQHandler              /* 0 */
+    .word PVD_IRQHandler               /* 1 */
+    .word TAMP_STAMP_IRQHandler        /* 2 */
+    .word RTC_WKUP_IRQHandler          /* 3 */
+    .word FLASH_IRQHandler             /* 4 */
+    .word RCC_IRQHandler               /* 5 */
+    .word EXTI0_IRQHandler             /* 6 */
+    .word EXTI1_IRQHandler             /* 7 */
+    .word EXTI2_IRQHandler             /* 8 */
+    .word EXTI3_IRQHandler             /* 9 */
+    .word EXTI4_IRQHandler             /* 10 */
+    .word DMA1_Stream0_IRQHandler      /* 11 */
+    .word DMA1_Stream1_IRQHandler      /* 12 */
+    .word DMA1_Stream2_IRQHandler      /* 13 */
+    .word DMA1_Stream3_IRQHandler      /* 14 */
+    .word DMA1_Stream4_IRQHandler      /* 15 */
+    .word DMA1_Stream5_IRQHandler      /* 16 */
+    .word DMA1_Stream6_IRQHandler      /* 17 */
+    .word ADC_IRQHandler               /* 18 */
+    .word CAN1_TX_IRQHandler           /* 19 */
+    .word CAN1_RX0_IRQHandler          /* 20 */
+    .word CAN1_RX1_IRQHandler          /* 21 */
+    .word CAN1_SCE_IRQHandler          /* 22 */
+    .word EXTI9_5_IRQHandler           /* 23 */
+    .word TIM1_BRK_TIM9_IRQHandler     /* 24 */
+    .word TIM1_UP_TIM10_IRQHandler     /* 25 */
+    .word TIM1_TRG_COM_TIM11_IRQHandler /* 26 */
+    .word TIM1_CC_IRQHandler           /* 27 */
+    .word TIM2_IRQHandler              /* 28 */
+    .word TIM3_IRQHandler              /* 29 */
+    .word TIM4_IRQHandler              /* 30 */
+    .word I2C1_EV_IRQHandler           /* 31 */
+    .word I2C1_ER_IRQHandler           /* 32 */
+    .word I2C2_EV_IRQHandler           /* 33 */
+    .word I2C2_ER_IRQHandler           /* 34 */
+    .word SPI1_IRQHandler              /* 35 */
+    .word SPI2_IRQHandler              /* 36 */
+    .word USART1_IRQHandler            /* 37 */
+    .word USART2_IRQHandler            /* 38 */
+    .word USART3_IRQHandler            /* 39 */
+    .word EXTI15_10_IRQHandler         /* 40 */
+    .word RTC_Alarm_IRQHandler         /* 41 */
+    .word OTG_FS_WKUP_IRQHandler       /* 42 */
+    .word TIM8_BRK_TIM12_IRQHandler    /* 43 */
+    .word TIM8_UP_TIM13_IRQHandler     /* 44 */
+    .word TIM8_TRG_COM_TIM14_IRQHandler /* 45 */
+    .word TIM8_CC_IRQHandler           /* 46 */
+    .word DMA1_Stream7_IRQHandler      /* 47 */
+    .word FMC_IRQHandler               /* 48 */
+    .word SDIO_IRQHandler              /* 49 */
+    .word TIM5_IRQHandler              /* 50 */
+    .word SPI3_IRQHandler              /* 51 */
+    .word UART4_IRQHandler             /* 52 */
+    .word UART5_IRQHandler             /* 53 */
+    .word TIM6_DAC_IRQHandler          /* 54 */
+    .word TIM7_IRQHandler              /* 55 */
+    .word DMA2_Stream0_IRQHandler      /* 56 */
+    .word DMA2_Stream1_IRQHandler      /* 57 */
+    .word DMA2_Stream2_IRQHandler      /* 58 */
+    .word DMA2_Stream3_IRQHandler      /* 59 */
+    .word DMA2_Stream4_IRQHandler      /* 60 */
+    .word 0                  /* 61: Reserved */
+    .word 0                  /* 62: Reserved */
+    .word CAN2_TX_IRQHandler           /* 63 */
+    .word CAN2_RX0_IRQHandler          /* 64 */
+    .word CAN2_RX1_IRQHandler          /* 65 */
+    .word CAN2_SCE_IRQHandler          /* 66 */
+    .word OTG_FS_IRQHandler            /* 67 */
+    .word DMA2_Stream5_IRQHandler      /* 68 */
+    .word DMA2_Stream6_IRQHandler      /* 69 */
+    .word DMA2_Stream7_IRQHandler      /* 70 */
+    .word USART6_IRQHandler            /* 71 */
+    .word I2C3_EV_IRQHandler           /* 72 */
+    .word I2C3_ER_IRQHandler           /* 73 */
+    .word OTG_HS_EP1_OUT_IRQHandler    /* 74 */
+    .word OTG_HS_EP1_IN_IRQHandler     /* 75 */
+    .word OTG_HS_WKUP_IRQHandler       /* 76 */
+    .word OTG_HS_IRQHandler            /* 77 */
+    .word DCMI_IRQHandler              /* 78 */
+    .word 0                  /* 79: Reserved */
+    .word 0                  /* 80: Reserved */
+    .word FPU_IRQHandler               /* 81 */
+    .word 0                  /* 82: Reserved */
+    .word 0                  /* 83: Reserved */
+    .word SPI4_IRQHandler              /* 84 */
+    .word 0                  /* 85: Reserved */
+    .word 0                  /* 86: Reserved */
+    .word SAI1_IRQHandler              /* 87 */
+    .word 0                  /* 88: Reserved */
+    .word 0                  /* 89: Reserved */
+    .word 0                  /* 90: Reserved */
+    .word SAI2_IRQHandler              /* 91 */
+    .word QUADSPI_IRQHandler           /* 92 */
+    .word HDMI_CEC_IRQHandler          /* 93 */
+    .word SPDIF_RX_IRQHandler          /* 94 */
+    .word FMPI2C1_EV_IRQHandler        /* 95 */
+    .word FMPI2C1_ER_IRQHandler        /* 96 */
+_vector_table_end:
+.size _vector_table, . - _vector_table
+
 /* -----------------------------------------------------------------------------
  * Reset Handler
  * -------------------------------------------------------------------------- */
@@ -45,12 +147,26 @@ _vector_table:
  * @brief Reset_Handler - Entry point after MCU reset.
  *
  * - Copies initialized data from FLASH (.data) to SRAM
+ * - Copies SRAM-resident code and tables (.ramfunc) from FLASH to SRAM
+ * - Enables the FPU (CP10/CP11) with automatic, lazy FP context stacking
  * - Clears uninitialized data (.bss)
  * - Calls main()
  */
 Reset_Handler:
+    ldr r0, =0xE000ED88      /* SCB->CPACR */
+    ldr r1, [r0]
+    orr r1, r1, #(0xF << 20) /* CP10 and CP11 full access */
+    str r1, [r0]
+
+    ldr r0, =0xE000EF34      /* FPU->FPCCR */
+    ldr r1, [r0]
+    orr r1, r1, #(0x3 << 30) /* ASPEN | LSPEN: ISRs stack FP regs only if they use them */
+    str r1, [r0]
+    dsb
+    isb                      /* FPU usable from the next instruction */
+
     ldr r0, =_sdata          /* Start of .data in SRAM */
-    ldr r1, =_etext          /* End of .text in FLASH (start of init data) */
+    ldr r1, =_sidata         /* Load address of .data in FLASH */
     ldr r2, =_edata          /* End of .data in SRAM */
 
 .data_copy:
@@ -60,6 +176,17 @@ Reset_Handler:
     strlt r3, [r0], #4
     blt .data_copy
 
+    ldr r0, =_sramfunc       /* Start of .ramfunc in SRAM */
+    ldr r1, =_siramfunc      /* Load address of .ramfunc in FLASH */
+    ldr r2, =_eramfunc       /* End of .ramfunc */
+
+.ramfunc_copy:
+    cmp r0, r2
+    ittt lt                  /* Same word copy as .data */
+    ldrlt r3, [r1], #4
+    strlt r3, [r0], #4
+    blt .ramfunc_copy
+
     ldr r0, =_sbss           /* Start of .bss */
     ldr r1, =_ebss           /* End of .bss */
     movs r2, #0              /* Zero value for clearing */
@@ -89,3 +216,177 @@ infinite_loop:
 .thumb_set Debug_Monitor,  infinite_loop
 .thumb_set PendSV,         infinite_loop
 .thumb_set SysTick_Handler,infinite_loop
+
+/* Device IRQ handlers */
+.weak WWDG_IRQHandler
+.thumb_set WWDG_IRQHandler,infinite_loop
+.weak PVD_IRQHandler
+.thumb_set PVD_IRQHandler,infinite_loop
+.weak TAMP_STAMP_IRQHandler
+.thumb_set TAMP_STAMP_IRQHandler,infinite_loop
+.weak RTC_WKUP_IRQHandler
+.thumb_set RTC_WKUP_IRQHandler,infinite_loop
+.weak FLASH_IRQHandler
+.thumb_set FLASH_IRQHandler,infinite_loop
+.weak RCC_IRQHandler
+.thumb_set RCC_IRQHandler,infinite_loop
+.weak EXTI0_IRQHandler
+.thumb_set EXTI0_IRQHandler,infinite_loop
+.weak EXTI1_IRQHandler
+.thumb_set EXTI1_IRQHandler,infinite_loop
+.weak EXTI2_IRQHandler
+.thumb_set EXTI2_IRQHandler,infinite_loop
+.weak EXTI3_IRQHandler
+.thumb_set EXTI3_IRQHandler,infinite_loop
+.weak EXTI4_IRQHandler
+.thumb_set EXTI4_IRQHandler,infinite_loop
+.weak DMA1_Stream0_IRQHandler
+.thumb_set DMA1_Stream0_IRQHandler,infinite_loop
+.weak DMA1_Stream1_IRQHandler
+.thumb_set DMA1_Stream1_IRQHandler,infinite_loop
+.weak DMA1_Stream2_IRQHandler
+.thumb_set DMA1_Stream2_IRQHandler,infinite_loop
+.weak DMA1_Stream3_IRQHandler
+.thumb_set DMA1_Stream3_IRQHandler,infinite_loop
+.weak DMA1_Stream4_IRQHandler
+.thumb_set DMA1_Stream4_IRQHandler,infinite_loop
+.weak DMA1_Stream5_IRQHandler
+.thumb_set DMA1_Stream5_IRQHandler,infinite_loop
+.weak DMA1_Stream6_IRQHandler
+.thumb_set DMA1_Stream6_IRQHandler,infinite_loop
+.weak ADC_IRQHandler
+.thumb_set ADC_IRQHandler,infinite_loop
+.weak CAN1_TX_IRQHandler
+.thumb_set CAN1_TX_IRQHandler,infinite_loop
+.weak CAN1_RX0_IRQHandler
+.thumb_set CAN1_RX0_IRQHandler,infinite_loop
+.weak CAN1_RX1_IRQHandler
+.thumb_set CAN1_RX1_IRQHandler,infinite_loop
+.weak CAN1_SCE_IRQHandler
+.thumb_set CAN1_SCE_IRQHandler,infinite_loop
+.weak EXTI9_5_IRQHandler
+.thumb_set EXTI9_5_IRQHandler,infinite_loop
+.weak TIM1_BRK_TIM9_IRQHandler
+.thumb_set TIM1_BRK_TIM9_IRQHandler,infinite_loop
+.weak TIM1_UP_TIM10_IRQHandler
+.thumb_set TIM1_UP_TIM10_IRQHandler,infinite_loop
+.weak TIM1_TRG_COM_TIM11_IRQHandler
+.thumb_set TIM1_TRG_COM_TIM11_IRQHandler,infinite_loop
+.weak TIM1_CC_IRQHandler
+.thumb_set TIM1_CC_IRQHandler,infinite_loop
+.weak TIM2_IRQHandler
+.thumb_set TIM2_IRQHandler,infinite_loop
+.weak TIM3_IRQHandler
+.thumb_set TIM3_IRQHandler,infinite_loop
+.weak TIM4_IRQHandler
+.thumb_set TIM4_IRQHandler,infinite_loop
+.weak I2C1_EV_IRQHandler
+.thumb_set I2C1_EV_IRQHandler,infinite_loop
+.weak I2C1_ER_IRQHandler
+.thumb_set I2C1_ER_IRQHandler,infinite_loop
+.weak I2C2_EV_IRQHandler
+.thumb_set I2C2_EV_IRQHandler,infinite_loop
+.weak I2C2_ER_IRQHandler
+.thumb_set I2C2_ER_IRQHandler,infinite_loop
+.weak SPI1_IRQHandler
+.thumb_set SPI1_IRQHandler,infinite_loop
+.weak SPI2_IRQHandler
+.thumb_set SPI2_IRQHandler,infinite_loop
+.weak USART1_IRQHandler
+.thumb_set USART1_IRQHandler,infinite_loop
+.weak USART2_IRQHandler
+.thumb_set USART2_IRQHandler,infinite_loop
+.weak USART3_IRQHandler
+.thumb_set USART3_IRQHandler,infinite_loop
+.weak EXTI15_10_IRQHandler
+.thumb_set EXTI15_10_IRQHandler,infinite_loop
+.weak RTC_Alarm_IRQHandler
+.thumb_set RTC_Alarm_IRQHandler,infinite_loop
+.weak OTG_FS_WKUP_IRQHandler
+.thumb_set OTG_FS_WKUP_IRQHandler,infinite_loop
+.weak TIM8_BRK_TIM12_IRQHandler
+.thumb_set TIM8_BRK_TIM12_IRQHandler,infinite_loop
+.weak TIM8_UP_TIM13_IRQHandler
+.thumb_set TIM8_UP_TIM13_IRQHandler,infinite_loop
+.weak TIM8_TRG_COM_TIM14_IRQHandler
+.thumb_set TIM8_TRG_COM_TIM14_IRQHandler,infinite_loop
+.weak TIM8_CC_IRQHandler
+.thumb_set TIM8_CC_IRQHandler,infinite_loop
+.weak DMA1_Stream7_IRQHandler
+.thumb_set DMA1_Stream7_IRQHandler,infinite_loop
+.weak FMC_IRQHandler
+.thumb_set FMC_IRQHandler,infinite_loop
+.weak SDIO_IRQHandler
+.thumb_set SDIO_IRQHandler,infinite_loop
+.weak TIM5_IRQHandler
+.thumb_set TIM5_IRQHandler,infinite_loop
+.weak SPI3_IRQHandler
+.thumb_set SPI3_IRQHandler,infinite_loop
+.weak UART4_IRQHandler
+.thumb_set UART4_IRQHandler,infinite_loop
+.weak UART5_IRQHandler
+.thumb_set UART5_IRQHandler,infinite_loop
+.weak TIM6_DAC_IRQHandler
+.thumb_set TIM6_DAC_IRQHandler,infinite_loop
+.weak TIM7_IRQHandler
+.thumb_set TIM7_IRQHandler,infinite_loop
+.weak DMA2_Stream0_IRQHandler
+.thumb_set DMA2_Stream0_IRQHandler,infinite_loop
+.weak DMA2_Stream1_IRQHandler
+.thumb_set DMA2_Stream1_IRQHandler,infinite_loop
+.weak DMA2_Stream2_IRQHandler
+.thumb_set DMA2_Stream2_IRQHandler,infinite_loop
+.weak DMA2_Stream3_IRQHandler
+.thumb_set DMA2_Stream3_IRQHandler,infinite_loop
+.weak DMA2_Stream4_IRQHandler
+.thumb_set DMA2_Stream4_IRQHandler,infinite_loop
+.weak CAN2_TX_IRQHandler
+.thumb_set CAN2_TX_IRQHandler,infinite_loop
+.weak CAN2_RX0_IRQHandler
+.thumb_set CAN2_RX0_IRQHandler,infinite_loop
+.weak CAN2_RX1_IRQHandler
+.thumb_set CAN2_RX1_IRQHandler,infinite_loop
+.weak CAN2_SCE_IRQHandler
+.thumb_set CAN2_SCE_IRQHandler,infinite_loop
+.weak OTG_FS_IRQHandler
+.thumb_set OTG_FS_IRQHandler,infinite_loop
+.weak DMA2_Stream5_IRQHandler
+.thumb_set DMA2_Stream5_IRQHandler,infinite_loop
+.weak DMA2_Stream6_IRQHandler
+.thumb_set DMA2_Stream6_IRQHandler,infinite_loop
+.weak DMA2_Stream7_IRQHandler
+.thumb_set DMA2_Stream7_IRQHandler,infinite_loop
+.weak USART6_IRQHandler
+.thumb_set USART6_IRQHandler,infinite_loop
+.weak I2C3_EV_IRQHandler
+.thumb_set I2C3_EV_IRQHandler,infinite_loop
+.weak I2C3_ER_IRQHandler
+.thumb_set I2C3_ER_IRQHandler,infinite_loop
+.weak OTG_HS_EP1_OUT_IRQHandler
+.thumb_set OTG_HS_EP1_OUT_IRQHandler,infinite_loop
+.weak OTG_HS_EP1_IN_IRQHandler
+.thumb_set OTG_HS_EP1_IN_IRQHandler,infinite_loop
+.weak OTG_HS_WKUP_IRQHandler
+.thumb_set OTG_HS_WKUP_IRQHandler,infinite_loop
+.weak OTG_HS_IRQHandler
+.thumb_set OTG_HS_IRQHandler,infinite_loop
+.weak DCMI_IRQHandler
+.thumb_set DCMI_IRQHandler,infinite_loop
+.weak FPU_IRQHandler
+.thumb_set FPU_IRQHandler,infinite_loop
+.weak SPI4_IRQHandler
+.thumb_set SPI4_IRQHandler,infinite_loop
+.weak SAI1_IRQHandler
+.thumb_set SAI1_IRQHandler,infinite_loop
+.weak SAI2_IRQHandler
+.thumb_set SAI2_IRQHandler,infinite_loop
+.weak QUADSPI_IRQHandler
+.thumb_set QUADSPI_IRQHandler,infinite_loop
+.weak HDMI_CEC_IRQHandler
+.thumb_set HDMI_CEC_IRQHandler,infinite_loop
+.weak SPDIF_RX_IRQHandler
+.thumb_set SPDIF_RX_IRQHandler,infinite_loop
+.weak FMPI2C1_EV_IRQHandler
+.thumb_set FMPI2C1_EV_IRQHandler,infinite_loop
+.weak FMPI2C1_ER_IRQHandler
+.thumb_set FMPI2C1_ER_IRQHandler,infinite_loop
@@ -0,0 +1,315 @@
+/**
+ * @file hal_adc.c
+ * @brief ADC HAL implementation for STM32F446RE.
+ *
+ * Programs the regular sequence and trigger of ADC1–ADC3, streams results
+ * into circular DMA buffers (DDS keeps the requests going after each wrap)
+ * and sets up the common block for dual/triple interleaved mode. Direct
+ * register access only.
+ */
+
+#include <stdint.h>
+#include "hal_adc.h"
+#include "hal_dma.h"
+#include "hal_tim.h"
+#include "hal_rcc.h"
+#include "hal_systick.h"
+
+/**
+ * @brief Per-ADC acquisition state.
+ */
+typedef struct {
+    adc_trigger_t trigger;   /**< Start source from adc_init() */
+    adc_callback_t cb;       /**< Half/full callback, or 0 */
+    void *ctx;               /**< User pointer */
+} adc_state_t;
+
+/// State of ADC1, ADC2, ADC3.
+static adc_state_t adc_state[3];
+
+/// Register blocks, same indexing as `adc_state`.
+static ADC_TypeDef *const adc_regs[3] = { ADC1, ADC2, ADC3 };
+
+/**
+ * @brief Maps an ADC instance to its table index.
+ *
+ * The DMA2 stream of each ADC is the `dma_rx` request of its descriptor.
+ *
+ * @param adc ADC instance.
+ * @return int 0–2, or -1 if unknown.
+ */
+static int adc_index(ADC_TypeDef *adc) {
+    return periph_index(adc, PERIPH_KIND_ADC);
+}
+
+/**
+ * @brief Selects the smallest ADCPRE divider that keeps the ADC clock legal.
+ */
+static void adc_set_clock(void) {
+    uint32_t pclk2 = rcc_get_pclk(ADC1);                 // ADC1–3 share the APB2 prescaler
+    uint32_t pre = 0;
+
+    while (pre < 3U && pclk2 / (2U * (pre + 1U)) > ADC_MAX_CLOCK_HZ) pre++;
+    ADC_COMMON->CCR = (ADC_COMMON->CCR & ~ADC_CCR_ADCPRE_MSK) | (pre << ADC_CCR_ADCPRE_POS);
+}
+
+/**
+ * @brief Sets the sampling time of one channel.
+ *
+ * @param adc ADC instance.
+ * @param channel Channel 0–18.
+ * @param smp Sampling time code.
+ */
+static void adc_set_sample_time(ADC_TypeDef *adc, uint8_t channel, adc_sample_time_t smp) {
+    volatile uint32_t *reg = (channel < 10U) ? &adc->SMPR2 : &adc->SMPR1;
+    uint32_t shift = (uint32_t)(channel % 10U) * 3U;
+
+    *reg = (*reg & ~(0x7U << shift)) | ((uint32_t)smp << shift);
+}
+
+/**
+ * @brief Starts conversions according to the trigger source.
+ *
+ * A software trigger sets continuous mode and starts now; a timer trigger
+ * arms the rising-edge external trigger and waits for TRGO.
+ *
+ * @param adc ADC instance.
+ * @param trigger Start source.
+ */
+static void adc_go(ADC_TypeDef *adc, adc_trigger_t trigger) {
+    if (trigger == ADC_TRIG_SOFTWARE) {
+        adc->CR2 |= ADC_CR2_CONT;
+        adc->CR2 |= ADC_CR2_SWSTART;
+    } else {
+        adc->CR2 = (adc->CR2 & ~(ADC_CR2_EXTSEL_MSK | ADC_CR2_EXTEN_MSK))
+                 | ((uint32_t)trigger << ADC_CR2_EXTSEL_POS) | ADC_CR2_EXTEN_RISING;
+    }
+}
+
+/**
+ * @brief Stops starting new conversions and drops the DMA request.
+ *
+ * @param adc ADC instance.
+ */
+static void adc_halt(ADC_TypeDef *adc) {
+    adc->CR2 &= ~(ADC_CR2_CONT | ADC_CR2_EXTEN_MSK | ADC_CR2_DMA | ADC_CR2_DDS);
+    adc->SR = ~(ADC_SR_OVR | ADC_SR_EOC | ADC_SR_STRT);
+}
+
+/**
+ * @brief DMA stream callback: forwards half/full events.
+ *
+ * @param flags Pending stream flags.
+ * @param ctx ADC state.
+ */
+static void adc_dma_irq(uint32_t flags, void *ctx) {
+    adc_state_t *st = (adc_state_t *)ctx;
+    ADC_TypeDef *adc = adc_regs[st - adc_state];
+
+    if (!st->cb) return;
+    if (flags & DMA_FLAG_HTIF) st->cb(adc, 0, st->ctx);
+    if (flags & DMA_FLAG_TCIF) st->cb(adc, 1, st->ctx);
+}
+
+/**
+ * @brief Enables the stream in circular mode with half/full interrupts.
+ *
+ * @param idx ADC index (selects the stream and state).
+ * @param cr Extra stream bits (data sizes).
+ * @param periph Data register to read.
+ * @param buf Buffer.
+ * @param count Number of DMA items.
+ */
+static void adc_dma_start(int idx, uint32_t cr, volatile void *periph, void *buf, uint16_t count) {
+    const dma_request_t *req = &periph_lookup(adc_regs[idx])->dma_rx;
+
+    rcc_enable_dma(DMA2);
+    cr |= DMA_SxCR_DIR_P2M | DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_PL_HIGH;
+    if (adc_state[idx].cb) cr |= DMA_SxCR_HTIE | DMA_SxCR_TCIE;
+
+    dma_stream_attach(req, adc_state[idx].cb ? adc_dma_irq : 0, &adc_state[idx]);
+    dma_stream_start(req, cr, periph, buf, count);
+}
+
+/**
+ * @brief Power up an ADC and program its regular sequence.
+ *
+ * @param adc ADC instance.
+ * @param cfg Sequence and conversion settings.
+ * @return int 0 on success, -1 on invalid arguments.
+ */
+int adc_init(ADC_TypeDef *adc, const adc_config_t *cfg) {
+    int idx = adc_index(adc);
+    uint32_t sqr[3] = { 0, 0, 0 };                           // SQR3, SQR2, SQR1
+
+    if (idx < 0 || !cfg || !cfg->channels || cfg->count == 0 || cfg->count > 16) return -1;
+    for (uint8_t i = 0; i < cfg->count; i++) {
+        if (cfg->channels[i] > 18U) return -1;
+        sqr[i / 6U] |= (uint32_t)cfg->channels[i] << ((i % 6U) * 5U);
+    }
+
+    rcc_enable_adc(adc);
+    adc_set_clock();
+
+    adc->CR2 = 0;                                            // off, no trigger, no DMA
+    adc->CR1 = ((uint32_t)cfg->resolution << ADC_CR1_RES_POS) | (cfg->count > 1U ? ADC_CR1_SCAN : 0U);
+    adc->SQR3 = sqr[0];
+    adc->SQR2 = sqr[1];
+    adc->SQR1 = sqr[2] | ((uint32_t)(cfg->count - 1U) << ADC_SQR1_L_POS);
+    for (uint8_t i = 0; i < cfg->count; i++) adc_set_sample_time(adc, cfg->channels[i], cfg->sample_time);
+
+    adc_state[idx].trigger = cfg->trigger;
+
+    adc->CR2 = ADC_CR2_ADON;
+    delay_us(3);                                             // tSTAB
+    return 0;
+}
+
+/**
+ * @brief Software-triggered single conversion.
+ *
+ * @param adc ADC instance.
+ * @param channel Channel 0–18.
+ * @return uint16_t Result.
+ */
+uint16_t adc_read(ADC_TypeDef *adc, uint8_t channel) {
+    adc->CR1 &= ~ADC_CR1_SCAN;
+    adc->SQR1 &= ~(0xFU << ADC_SQR1_L_POS);
+    adc->SQR3 = channel & 0x1FU;
+
+    adc->SR = ~ADC_SR_EOC;
+    adc->CR2 |= ADC_CR2_SWSTART;
+    while (!(adc->SR & ADC_SR_EOC));
+    return (uint16_t)adc->DR;                                // clears EOC
+}
+
+/**
+ * @brief Start circular DMA acquisition on one ADC.
+ *
+ * The stream is enabled before the first conversion is allowed to start,
+ * so no result is missed.
+ *
+ * @param adc ADC instance.
+ * @param buf Sample buffer.
+ * @param len Samples in the buffer.
+ * @param cb Half/full callback.
+ * @param ctx User pointer.
+ * @return int 0 if started, -1 on invalid arguments.
+ */
+int adc_start_dma(ADC_TypeDef *adc, uint16_t *buf, uint16_t len, adc_callback_t cb, void *ctx) {
+    int idx = adc_index(adc);
+
+    if (idx < 0 || !buf || len < 2U || (len & 1U)) return -1;
+
+    adc_halt(adc);
+    dma_stream_disable(&periph_lookup(adc)->dma_rx);
+
+    adc_state[idx].cb = cb;
+    adc_state[idx].ctx = ctx;
+    adc_dma_start(idx, DMA_SxCR_PSIZE_16 | DMA_SxCR_MSIZE_16, &adc->DR, buf, len);
+
+    adc->CR2 |= ADC_CR2_DMA | ADC_CR2_DDS;
+    adc_go(adc, adc_state[idx].trigger);
+    return 0;
+}
+
+/**
+ * @brief Stop conversions and DMA.
+ *
+ * The DMA stream is released only if this ADC was using it (CR2.DMA, or the
+ * common DMA mode for ADC1 in a multi-ADC acquisition), since the stream may
+ * belong to another driver (SPI1/SPI4 TX, TIM1/TIM8 requests).
+ *
+ * @param adc ADC instance (ADC1 also ends a multi-ADC acquisition).
+ */
+void adc_stop(ADC_TypeDef *adc) {
+    int idx = adc_index(adc);
+    const dma_request_t *req;
+    uint32_t dma;
+
+    if (idx < 0) return;
+
+    dma = (adc->CR2 & ADC_CR2_DMA) ||
+          (adc == ADC1 && (ADC_COMMON->CCR & ADC_CCR_DMA_MSK));   // read before adc_halt() clears it
+    adc_halt(adc);
+    if (adc == ADC1 && (ADC_COMMON->CCR & ADC_CCR_MULTI_MSK)) {
+        adc_halt(ADC2);
+        adc_halt(ADC3);
+        ADC_COMMON->CCR &= ~(ADC_CCR_MULTI_MSK | ADC_CCR_DMA_MSK | ADC_CCR_DDS);
+    }
+
+    if (dma) {
+        req = &periph_lookup(adc)->dma_rx;
+        dma_stream_disable(req);
+        dma_stream_attach(req, 0, 0);
+    }
+    adc_state[idx].cb = 0;
+}
+
+/**
+ * @brief Run the trigger timer with TRGO = update.
+ *
+ * @param trigger Timer trigger.
+ * @param rate_hz Sequences per second.
+ * @return int 0 exact, 1 approximate, -1 error.
+ */
+int adc_set_trigger_rate(adc_trigger_t trigger, uint32_t rate_hz) {
+    if (trigger == ADC_TRIG_TIM2_TRGO) return tim_set_trgo_rate(TIM2, rate_hz);
+    if (trigger == ADC_TRIG_TIM3_TRGO) return tim_set_trgo_rate(TIM3, rate_hz);
+    if (trigger == ADC_TRIG_TIM8_TRGO) return tim_set_trgo_rate(TIM8, rate_hz);
+    return -1;
+}
+
+/**
+ * @brief Start dual/triple interleaved acquisition.
+ *
+ * Slaves are powered before the master; only the master gets the external
+ * trigger, and with a software start every ADC runs in continuous mode.
+ *
+ * @param mode Multi-ADC mode.
+ * @param cfg Single-channel configuration.
+ * @param delay_cycles Interleave delay in ADC clocks.
+ * @param buf Sample buffer.
+ * @param len Samples in the buffer.
+ * @param cb Half/full callback.
+ * @param ctx User pointer.
+ * @return int 0 if started, -1 on invalid arguments.
+ */
+int adc_multi_start_dma(adc_multi_mode_t mode, const adc_config_t *cfg, uint8_t delay_cycles,
+                        uint16_t *buf, uint16_t len, adc_callback_t cb, void *ctx) {
+    adc_config_t slave;
+    uint8_t n;
+
+    if (mode == ADC_MODE_DUAL_INTERLEAVED) n = 2;
+    else if (mode == ADC_MODE_TRIPLE_INTERLEAVED) n = 3;
+    else return -1;
+
+    if (!cfg || cfg->count != 1U || delay_cycles < 5U || delay_cycles > 20U) return -1;
+    if (!buf || ((uintptr_t)buf & 3U) || len < 4U || (len & 3U)) return -1;
+
+    adc_stop(ADC1);
+    adc_halt(ADC2);                                   // not adc_stop(): streams 3/1 may serve SPI1/SPI4/TIM8
+    if (n == 3) adc_halt(ADC3);
+
+    slave = *cfg;
+    slave.trigger = ADC_TRIG_SOFTWARE;
+    if (adc_init(ADC2, &slave) != 0) return -1;
+    if (n == 3 && adc_init(ADC3, &slave) != 0) return -1;
+    if (adc_init(ADC1, cfg) != 0) return -1;
+
+    ADC_COMMON->CCR = (ADC_COMMON->CCR & ~(ADC_CCR_MULTI_MSK | ADC_CCR_DELAY_MSK | ADC_CCR_DMA_MSK | ADC_CCR_DDS))
+                    | (uint32_t)mode
+                    | ((uint32_t)(delay_cycles - 5U) << ADC_CCR_DELAY_POS)
+                    | ADC_CCR_DMA_MODE2 | ADC_CCR_DDS;
+
+    adc_state[0].cb = cb;
+    adc_state[0].ctx = ctx;
+    adc_dma_start(0, DMA_SxCR_PSIZE_32 | DMA_SxCR_MSIZE_32, &ADC_COMMON->CDR, buf, (uint16_t)(len / 2U));
+
+    if (cfg->trigger == ADC_TRIG_SOFTWARE) {
+        ADC2->CR2 |= ADC_CR2_CONT;
+        if (n == 3) ADC3->CR2 |= ADC_CR2_CONT;
+    }
+    adc_go(ADC1, cfg->trigger);
+    return 0;
+}
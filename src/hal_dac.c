@@ -0,0 +1,169 @@
+/**
+ * @file hal_dac.c
+ * @brief DAC HAL implementation for STM32F446RE.
+ *
+ * Channel fields are programmed through the channel 1 bit definitions
+ * shifted by `DAC_CR_CH_SHIFT` for channel 2. Triggered output relies on
+ * `tim_set_trgo_rate()` for the TIM6/TIM7 pacing. Direct register access only.
+ */
+
+#include <stdint.h>
+#include "hal_dac.h"
+#include "hal_dma.h"
+#include "hal_tim.h"
+#include "hal_rcc.h"
+#include "hal_gpio.h"
+
+/// DMA1 stream of each channel (index = channel - 1).
+static const dma_request_t dac_dma[2] = {
+    { DMA1, 5, 7 },   // DAC1
+    { DMA1, 6, 7 },   // DAC2
+};
+
+/// Channel fields cleared before reprogramming a trigger mode.
+#define DAC_CR_MODE_MSK (DAC_CR_TEN | DAC_CR_TSEL_MSK | DAC_CR_WAVE_MSK | DAC_CR_MAMP_MSK | DAC_CR_DMAEN)
+
+/**
+ * @brief Bit offset of a channel's fields in CR.
+ *
+ * @param ch Channel.
+ * @return uint32_t 0 or 16.
+ */
+static uint32_t dac_shift(dac_channel_t ch) {
+    return (ch == DAC_CHANNEL_2) ? DAC_CR_CH_SHIFT : 0U;
+}
+
+/**
+ * @brief 12-bit right-aligned holding register of a channel.
+ *
+ * @param ch Channel.
+ * @return volatile uint32_t* DHR12Rx.
+ */
+static volatile uint32_t *dac_dhr(dac_channel_t ch) {
+    return (ch == DAC_CHANNEL_2) ? &DAC->DHR12R2 : &DAC->DHR12R1;
+}
+
+/**
+ * @brief Timer behind a trigger code.
+ *
+ * @param trig Trigger.
+ * @return TIM_TypeDef* TIM6, TIM7, or 0.
+ */
+static TIM_TypeDef *dac_timer(dac_trigger_t trig) {
+    if (trig == DAC_TRIG_TIM6_TRGO) return TIM6;
+    if (trig == DAC_TRIG_TIM7_TRGO) return TIM7;
+    return 0;
+}
+
+/**
+ * @brief Enable a DAC channel.
+ *
+ * @param ch Channel.
+ */
+void dac_init(dac_channel_t ch) {
+    uint32_t sh = dac_shift(ch);
+
+    rcc_enable_dac();
+    rcc_enable_gpio(GPIO_PORT_A);
+    gpio_mode(PIN('A', (ch == DAC_CHANNEL_2) ? 5 : 4), GPIO_MODE_ANALOG);
+
+    DAC->CR &= ~(0xFFFFU << sh);                             // buffer on, untriggered
+    *dac_dhr(ch) = 0;
+    DAC->CR |= DAC_CR_EN << sh;
+}
+
+/**
+ * @brief Write a static output level.
+ *
+ * @param ch Channel.
+ * @param value 12-bit code.
+ */
+void dac_write(dac_channel_t ch, uint16_t value) {
+    *dac_dhr(ch) = value & DAC_MAX_VALUE;
+}
+
+/**
+ * @brief Loop a sample table by DMA, paced by TIM6/TIM7.
+ *
+ * The stream runs before the trigger is enabled; the timer is started last.
+ *
+ * @param ch Channel.
+ * @param buf Samples.
+ * @param len Number of samples.
+ * @param trig Trigger timer.
+ * @param sample_rate_hz Samples per second.
+ * @return int 0 exact, 1 approximate, -1 error.
+ */
+int dac_start_dma(dac_channel_t ch, const uint16_t *buf, uint16_t len,
+                  dac_trigger_t trig, uint32_t sample_rate_hz) {
+    const dma_request_t *req = &dac_dma[ch == DAC_CHANNEL_2];
+    uint32_t sh = dac_shift(ch);
+
+    if (!dac_timer(trig) || !buf || len == 0) return -1;
+
+    dac_stop(ch);
+    DAC->SR = (ch == DAC_CHANNEL_2) ? DAC_SR_DMAUDR2 : DAC_SR_DMAUDR1;
+
+    rcc_enable_dma(DMA1);
+    dma_stream_start(req, DMA_SxCR_DIR_M2P | DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_PL_HIGH |
+                          DMA_SxCR_PSIZE_16 | DMA_SxCR_MSIZE_16,
+                     dac_dhr(ch), buf, len);
+
+    DAC->CR |= (DAC_CR_TEN | ((uint32_t)trig << DAC_CR_TSEL_POS) | DAC_CR_DMAEN) << sh;
+    return tim_set_trgo_rate(dac_timer(trig), sample_rate_hz);
+}
+
+/**
+ * @brief Start the noise/triangle generator.
+ *
+ * @param ch Channel.
+ * @param wave Generator.
+ * @param amplitude MAMP code 0–11.
+ * @param offset DC offset.
+ * @param trig Trigger timer.
+ * @param step_rate_hz Steps per second.
+ * @return int 0 exact, 1 approximate, -1 error.
+ */
+int dac_start_wave(dac_channel_t ch, dac_wave_t wave, uint8_t amplitude, uint16_t offset,
+                   dac_trigger_t trig, uint32_t step_rate_hz) {
+    uint32_t sh = dac_shift(ch);
+
+    if (!dac_timer(trig) || wave == DAC_WAVE_NONE || amplitude > 11U) return -1;
+
+    dac_stop(ch);
+    *dac_dhr(ch) = offset & DAC_MAX_VALUE;
+    DAC->CR |= (DAC_CR_TEN | ((uint32_t)trig << DAC_CR_TSEL_POS) |
+                ((uint32_t)wave << DAC_CR_WAVE_POS) | ((uint32_t)amplitude << DAC_CR_MAMP_POS)) << sh;
+    return tim_set_trgo_rate(dac_timer(trig), step_rate_hz);
+}
+
+/**
+ * @brief Stop triggered output.
+ *
+ * Clearing TEN makes DHRx → DORx immediate again, so the pin settles on
+ * the holding register: the last DMA sample, or the wave offset. The stream
+ * is only touched if this channel was using it.
+ *
+ * @param ch Channel.
+ */
+void dac_stop(dac_channel_t ch) {
+    uint32_t sh = dac_shift(ch);
+    uint32_t dma = DAC->CR & (DAC_CR_DMAEN << sh);
+
+    DAC->CR &= ~(DAC_CR_MODE_MSK << sh);
+    if (dma) dma_stream_disable(&dac_dma[ch == DAC_CHANNEL_2]);
+}
+
+/**
+ * @brief Read and clear the DMA underrun flag.
+ *
+ * @param ch Channel.
+ * @return int 1 on underrun, else 0.
+ */
+int dac_underrun(dac_channel_t ch) {
+    uint32_t flag = (ch == DAC_CHANNEL_2) ? DAC_SR_DMAUDR2 : DAC_SR_DMAUDR1;
+
+    if (!(DAC->SR & flag)) return 0;
+    DAC->SR = flag;                                          // rc_w1
+    return 1;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file hal_dma.c
+ * @brief DMA stream helper implementation for STM32F446RE.
+ *
+ * Provides stream lookup, safe disable, flag access and a one-shot transfer
+ * start used by the peripheral drivers, and owns the DMA stream interrupt
+ * vectors so that several drivers can share a controller. Direct register
+ * access only.
+ */
+
+#include <stdint.h>
+#include "hal_dma.h"
+#include "hal_nvic.h"
+
+/**
+ * @brief Registered callback for one stream.
+ */
+typedef struct {
+    dma_callback_t cb;   /**< Callback, or 0 */
+    void *ctx;           /**< User pointer */
+} dma_slot_t;
+
+/// Callbacks for DMA1 streams 0–7 followed by DMA2 streams 0–7.
+static dma_slot_t dma_slots[16];
+
+/// NVIC line of each stream, same indexing as `dma_slots`.
+static const uint8_t dma_irqn[16] = {
+    DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+    DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn,
+    DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+    DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn
+};
+
+/**
+ * @brief Bit offset of a stream's flag field inside LISR/HISR (and LIFCR/HIFCR).
+ *
+ * Streams 0–3 live in the low registers, 4–7 in the high registers, with the
+ * same layout: 0, 6, 16, 22.
+ */
+static const uint8_t dma_flag_shift[4] = { 0, 6, 16, 22 };
+
+/**
+ * @brief Returns the register block of the stream named by `req`.
+ *
+ * @param req DMA request mapping.
+ * @return DMA_Stream_TypeDef* Stream registers.
+ */
+DMA_Stream_TypeDef *dma_stream_get(const dma_request_t *req) {
+    return &req->dma->STREAM[req->stream & 0x7];
+}
+
+/**
+ * @brief Clears EN and blocks until the stream reports disabled.
+ *
+ * @param req DMA request mapping.
+ */
+void dma_stream_disable(const dma_request_t *req) {
+    DMA_Stream_TypeDef *s = dma_stream_get(req);
+
+    s->CR &= ~DMA_SxCR_EN;
+    while (s->CR & DMA_SxCR_EN) {
+        // wait for the stream to finish its current beat
+    }
+}
+
+/**
+ * @brief Reads a stream's flags from LISR/HISR, shifted down to bit 0.
+ *
+ * @param req DMA request mapping.
+ * @return uint32_t `DMA_FLAG_*` bits currently set.
+ */
+uint32_t dma_stream_flags(const dma_request_t *req) {
+    uint8_t shift = dma_flag_shift[req->stream & 0x3];
+    uint32_t isr = (req->stream < 4) ? req->dma->LISR : req->dma->HISR;
+
+    return (isr >> shift) & DMA_FLAG_ALL;
+}
+
+/**
+ * @brief Clears a stream's flags through LIFCR/HIFCR.
+ *
+ * @param req   DMA request mapping.
+ * @param flags `DMA_FLAG_*` bits to clear.
+ */
+void dma_stream_clear_flags(const dma_request_t *req, uint32_t flags) {
+    uint32_t mask = (flags & DMA_FLAG_ALL) << dma_flag_shift[req->stream & 0x3];
+
+    if (req->stream < 4) req->dma->LIFCR = mask;
+    else                 req->dma->HIFCR = mask;
+}
+
+/**
+ * @brief Reprograms a stream and starts a transfer (one-shot, or circular with `DMA_SxCR_CIRC`).
+ *
+ * @param req    DMA request mapping.
+ * @param cr     `DMA_SxCR_*` configuration (CHSEL and EN are added here).
+ * @param periph Peripheral data register address.
+ * @param mem    Memory buffer address.
+ * @param count  Number of items to move.
+ */
+void dma_stream_start(const dma_request_t *req, uint32_t cr,
+                      volatile void *periph, const void *mem, uint16_t count) {
+    DMA_Stream_TypeDef *s = dma_stream_get(req);
+
+    dma_stream_disable(req);
+    dma_stream_clear_flags(req, DMA_FLAG_ALL);
+
+    s->PAR  = (uint32_t)(uintptr_t)periph;
+    s->M0AR = (uint32_t)(uintptr_t)mem;
+    s->NDTR = count;
+    s->CR   = cr | DMA_SxCR_CHSEL(req->channel);
+    s->CR  |= DMA_SxCR_EN;
+}
+
+/**
+ * @brief Stores the callback for a stream and enables its interrupt line.
+ *
+ * @param req DMA request mapping.
+ * @param cb Callback, or 0 to detach.
+ * @param ctx User pointer.
+ */
+void dma_stream_attach(const dma_request_t *req, dma_callback_t cb, void *ctx) {
+    uint8_t slot = (uint8_t)(((req->dma == DMA2) ? 8U : 0U) + (req->stream & 0x7));
+
+    dma_slots[slot].ctx = ctx;
+    dma_slots[slot].cb = cb;
+
+    if (cb) nvic_enable_irq((IRQn_Type)dma_irqn[slot]);
+    else    nvic_disable_irq((IRQn_Type)dma_irqn[slot]);
+}
+
+/**
+ * @brief Shared stream IRQ body: read and clear flags, then call the owner.
+ *
+ * @param dma DMA controller.
+ * @param stream Stream number.
+ */
+static void dma_irq_handler(DMA_TypeDef *dma, uint8_t stream) {
+    dma_request_t req = { dma, stream, 0 };
+    dma_slot_t *slot = &dma_slots[((dma == DMA2) ? 8U : 0U) + stream];
+    uint32_t flags = dma_stream_flags(&req);
+
+    dma_stream_clear_flags(&req, flags);
+    if (slot->cb) slot->cb(flags, slot->ctx);
+}
+
+void DMA1_Stream0_IRQHandler(void) { dma_irq_handler(DMA1, 0); }
+void DMA1_Stream1_IRQHandler(void) { dma_irq_handler(DMA1, 1); }
+void DMA1_Stream2_IRQHandler(void) { dma_irq_handler(DMA1, 2); }
+void DMA1_Stream3_IRQHandler(void) { dma_irq_handler(DMA1, 3); }
+void DMA1_Stream4_IRQHandler(void) { dma_irq_handler(DMA1, 4); }
+void DMA1_Stream5_IRQHandler(void) { dma_irq_handler(DMA1, 5); }
+void DMA1_Stream6_IRQHandler(void) { dma_irq_handler(DMA1, 6); }
+void DMA1_Stream7_IRQHandler(void) { dma_irq_handler(DMA1, 7); }
+void DMA2_Stream0_IRQHandler(void) { dma_irq_handler(DMA2, 0); }
+void DMA2_Stream1_IRQHandler(void) { dma_irq_handler(DMA2, 1); }
+void DMA2_Stream2_IRQHandler(void) { dma_irq_handler(DMA2, 2); }
+void DMA2_Stream3_IRQHandler(void) { dma_irq_handler(DMA2, 3); }
+void DMA2_Stream4_IRQHandler(void) { dma_irq_handler(DMA2, 4); }
+void DMA2_Stream5_IRQHandler(void) { dma_irq_handler(DMA2, 5); }
+void DMA2_Stream6_IRQHandler(void) { dma_irq_handler(DMA2, 6); }
+void DMA2_Stream7_IRQHandler(void) { dma_irq_handler(DMA2, 7); }
@@ -0,0 +1,204 @@
+/**
+ * @file hal_exti.c
+ * @brief GPIO external interrupt (EXTI) driver implementation for STM32F446RE.
+ *
+ * Owns the EXTI0–EXTI4, EXTI9_5 and EXTI15_10 vectors. Each vector reads the
+ * pending register once, acknowledges every pending line of its group with a
+ * single write and then walks the set bits, so a burst on several lines of a
+ * shared vector costs one interrupt entry. Direct register access only.
+ */
+
+#include <stdint.h>
+#include "hal_exti.h"
+#include "hal_rcc.h"
+#include "hal_nvic.h"
+#include "hal_bitband.h"
+#include "hal_timer.h"
+#include "hal_ramfunc.h"
+#include "stm32f4_gpio.h"
+
+/// Lines served by the shared EXTI9_5 vector.
+#define EXTI_GROUP_9_5    0x03E0U
+/// Lines served by the shared EXTI15_10 vector.
+#define EXTI_GROUP_15_10  0xFC00U
+
+/**
+ * @brief State of one EXTI line.
+ */
+typedef struct {
+    exti_callback_t cb;     /**< Callback, or 0 when the line is free */
+    void *ctx;              /**< User pointer */
+    uint16_t pin;           /**< Packed pin routed to this line */
+    uint32_t debounce_ms;   /**< Debounce window, 0 = disabled */
+    hal_timer_t debounce;   /**< One-shot timer that re-enables the line */
+} exti_slot_t;
+
+/// Per-line state, indexed by pin number.
+static exti_slot_t exti_slots[EXTI_GPIO_LINES];
+
+/**
+ * @brief Returns the NVIC line serving an EXTI line.
+ *
+ * @param line EXTI line (0–15).
+ * @return IRQn_Type Vector number.
+ */
+static IRQn_Type exti_irqn(uint8_t line) {
+    if (line <= 4) return (IRQn_Type)(EXTI0_IRQn + line);
+    if (line <= 9) return EXTI9_5_IRQn;
+    return EXTI15_10_IRQn;
+}
+
+/**
+ * @brief Debounce timer expiry: drops edges latched while masked, unmasks the line.
+ *
+ * Runs from `hal_timer_process()` in thread context.
+ *
+ * @param ctx Slot of the line.
+ */
+static void exti_debounce_done(void *ctx) {
+    uint8_t line = (uint8_t)((exti_slot_t *)ctx - exti_slots);
+
+    EXTI->PR = 1U << line;                       // rc_w1: clears only this line
+    BITBAND_PERIPH(&EXTI->IMR, line) = 1;
+}
+
+/**
+ * @brief Routes a pin to its EXTI line and enables the interrupt.
+ *
+ * @param pin  Packed pin.
+ * @param edge Rising, falling or both.
+ * @param cb   Callback.
+ * @param ctx  User pointer.
+ * @return int 0 on success, -1 if the line belongs to another port.
+ */
+int exti_attach(uint16_t pin, exti_edge_t edge, exti_callback_t cb, void *ctx) {
+    uint8_t port = GET_PORT(pin);
+    uint8_t line = GET_PIN(pin);
+    exti_slot_t *slot;
+    uint32_t bit, shift;
+
+    if (line >= EXTI_GPIO_LINES || port >= GPIO_PORT_COUNT) return -1;
+    slot = &exti_slots[line];
+    bit = 1U << line;
+    shift = (line & 0x3U) * 4U;
+    if (slot->cb && GET_PORT(slot->pin) != port) return -1;
+
+    rcc_enable_syscfg();
+
+    uint32_t primask = irq_save();
+
+    EXTI->IMR &= ~bit;
+    hal_timer_stop(&slot->debounce);
+
+    SYSCFG->EXTICR[line >> 2] = (SYSCFG->EXTICR[line >> 2] & ~(0xFU << shift)) | ((uint32_t)port << shift);
+
+    if (edge & EXTI_EDGE_RISING)  EXTI->RTSR |= bit;
+    else                          EXTI->RTSR &= ~bit;
+    if (edge & EXTI_EDGE_FALLING) EXTI->FTSR |= bit;
+    else                          EXTI->FTSR &= ~bit;
+
+    slot->cb = cb;
+    slot->ctx = ctx;
+    slot->pin = pin;
+    hal_timer_init(&slot->debounce, exti_debounce_done, slot);
+
+    EXTI->PR = bit;                              // drop an edge latched before attach
+    EXTI->IMR |= bit;
+
+    irq_restore(primask);
+
+    nvic_enable_irq(exti_irqn(line));
+    return 0;
+}
+
+/**
+ * @brief Masks the pin's EXTI line and removes its callback.
+ *
+ * Does nothing if the line is not attached to this pin's port. The NVIC
+ * vector stays enabled, since EXTI9_5 and EXTI15_10 are shared.
+ *
+ * @param pin Packed pin.
+ */
+void exti_detach(uint16_t pin) {
+    uint8_t line = GET_PIN(pin);
+    exti_slot_t *slot;
+
+    if (line >= EXTI_GPIO_LINES) return;
+    slot = &exti_slots[line];
+    if (!slot->cb || GET_PORT(slot->pin) != GET_PORT(pin)) return;   // line owned by another port
+
+    uint32_t primask = irq_save();
+
+    EXTI->IMR &= ~(1U << line);
+    EXTI->RTSR &= ~(1U << line);
+    EXTI->FTSR &= ~(1U << line);
+    EXTI->PR = 1U << line;
+    hal_timer_stop(&slot->debounce);
+    slot->cb = 0;
+    slot->ctx = 0;
+    slot->debounce_ms = 0;
+
+    irq_restore(primask);
+}
+
+/**
+ * @brief Sets the debounce window of an attached line.
+ *
+ * @param pin Packed pin.
+ * @param ms  Window in milliseconds, 0 disables.
+ */
+void exti_set_debounce(uint16_t pin, uint32_t ms) {
+    uint8_t line = GET_PIN(pin);
+
+    if (line >= EXTI_GPIO_LINES) return;
+    exti_slots[line].debounce_ms = ms;
+}
+
+/**
+ * @brief Raises the pin's line from software.
+ *
+ * @param pin Packed pin.
+ */
+void exti_trigger(uint16_t pin) {
+    uint8_t line = GET_PIN(pin);
+
+    if (line >= EXTI_GPIO_LINES) return;
+    EXTI->SWIER = 1U << line;
+}
+
+/**
+ * @brief Serves every pending, enabled line in `group`.
+ *
+ * PR and IMR are read once; all lines found are acknowledged in one write
+ * before their callbacks run, so an edge arriving during a callback pends the
+ * vector again instead of being lost. Lines with debounce are masked here and
+ * re-enabled by their timer, so bounce raises no further interrupts.
+ *
+ * @param group Mask of the lines served by the calling vector.
+ */
+HAL_RAMFUNC static void exti_dispatch(uint32_t group) {
+    uint32_t pending = EXTI->PR & EXTI->IMR & group;
+
+    EXTI->PR = pending;
+
+    while (pending) {
+        uint32_t line = (uint32_t)__builtin_ctz(pending);
+        exti_slot_t *slot = &exti_slots[line];
+
+        pending &= pending - 1U;
+
+        if (slot->debounce_ms) {
+            BITBAND_PERIPH(&EXTI->IMR, line) = 0;
+            hal_timer_start(&slot->debounce, slot->debounce_ms, 0);
+        }
+        if (slot->cb) slot->cb(slot->pin, slot->ctx);
+    }
+}
+
+void EXTI0_IRQHandler(void)     { exti_dispatch(1U << 0); }
+void EXTI1_IRQHandler(void)     { exti_dispatch(1U << 1); }
+void EXTI2_IRQHandler(void)     { exti_dispatch(1U << 2); }
+void EXTI3_IRQHandler(void)     { exti_dispatch(1U << 3); }
+void EXTI4_IRQHandler(void)     { exti_dispatch(1U << 4); }
+void EXTI9_5_IRQHandler(void)   { exti_dispatch(EXTI_GROUP_9_5); }
+void EXTI15_10_IRQHandler(void) { exti_dispatch(EXTI_GROUP_15_10); }
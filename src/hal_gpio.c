@@ -10,6 +10,8 @@
  */
 
 #include "hal_gpio.h"
+#include "hal_rcc.h"
+#include "hal_bitband.h"
 #include <stdint.h>
 
 /**
@@ -41,19 +43,81 @@ void gpio_init(gpio_config_t cfg) {
     uint8_t pin_num = GET_PIN(cfg.pin);
     GPIO_TypeDef *port = get_gpio_port(port_index);
 
+    // Single-bit field: one atomic bit-band store
+    BITBAND_PERIPH(&port->OTYPER, pin_num) = cfg.otype & 0x01;
+
     // Clear previous config
     port->MODER   &= ~(0x03 << (pin_num * 2));
-    port->OTYPER  &= ~(1 << pin_num);
     port->OSPEEDR &= ~(0x03 << (pin_num * 2));
     port->PUPDR   &= ~(0x03 << (pin_num * 2));
 
     // Apply new config
     port->MODER   |= ((cfg.mode   & 0x03) << (pin_num * 2));
-    port->OTYPER  |= ((cfg.otype  & 0x01) << pin_num);
     port->OSPEEDR |= ((cfg.speed  & 0x03) << (pin_num * 2));
     port->PUPDR   |= ((cfg.pull   & 0x03) << (pin_num * 2));
 }
 
+/**
+ * @brief Configures every pin in a table with one write per register per port.
+ *
+ * First pass collects the used ports and enables their clocks together; then
+ * each used port gets its masks and values accumulated in locals and is
+ * written with one read-modify-write per register.
+ *
+ * @param cfgs Pin configurations.
+ * @param n Number of entries.
+ */
+void gpio_init_table(const gpio_config_t *cfgs, size_t n) {
+    uint8_t used = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        uint8_t port_index = GET_PORT(cfgs[i].pin);
+        if (port_index < GPIO_PORT_COUNT) used |= (uint8_t)(1U << port_index);
+    }
+    rcc_enable_gpio_mask(used);
+
+    for (uint8_t p = 0; p < GPIO_PORT_COUNT; p++) {
+        if (!(used & (1U << p))) continue;
+
+        uint32_t mask2 = 0, mask1 = 0, maskl = 0, maskh = 0;
+        uint32_t moder = 0, otyper = 0, ospeedr = 0, pupdr = 0, afrl = 0, afrh = 0;
+
+        for (size_t i = 0; i < n; i++) {
+            const gpio_config_t *c = &cfgs[i];
+            if (GET_PORT(c->pin) != p) continue;
+
+            uint8_t pin_num = GET_PIN(c->pin) & 0xF;
+            uint32_t sh2 = pin_num * 2U;
+
+            mask2   |= 0x3U << sh2;
+            mask1   |= 1U << pin_num;
+            moder   |= ((uint32_t)c->mode  & 0x3U) << sh2;
+            otyper  |= ((uint32_t)c->otype & 0x1U) << pin_num;
+            ospeedr |= ((uint32_t)c->speed & 0x3U) << sh2;
+            pupdr   |= ((uint32_t)c->pull  & 0x3U) << sh2;
+
+            if (c->mode == GPIO_MODE_ALTFUNC) {
+                if (pin_num <= 7) {
+                    maskl |= 0xFU << (4U * pin_num);
+                    afrl  |= ((uint32_t)c->af & 0xFU) << (4U * pin_num);
+                } else {
+                    maskh |= 0xFU << (4U * (pin_num - 8U));
+                    afrh  |= ((uint32_t)c->af & 0xFU) << (4U * (pin_num - 8U));
+                }
+            }
+        }
+
+        GPIO_TypeDef *port = get_gpio_port(p);
+
+        port->OTYPER  = (port->OTYPER  & ~mask1) | otyper;
+        port->OSPEEDR = (port->OSPEEDR & ~mask2) | ospeedr;
+        port->PUPDR   = (port->PUPDR   & ~mask2) | pupdr;
+        if (maskl) port->AFRL = (port->AFRL & ~maskl) | afrl;
+        if (maskh) port->AFRH = (port->AFRH & ~maskh) | afrh;
+        port->MODER   = (port->MODER   & ~mask2) | moder;   // last: pins switch fully configured
+    }
+}
+
 /**
  * @brief Sets alternate function (AFx) for a GPIO pin.
  *
@@ -126,3 +190,28 @@ int gpio_read(uint16_t gpio_pin) {
 
     return (port->IDR & (1 << pin_num)) ? 1 : 0;
 }
+
+/**
+ * @brief Sets and clears pins of one port in one BSRR write.
+ *
+ * Set bits go in BSRR[15:0], reset bits in BSRR[31:16].
+ *
+ * @param port Port index.
+ * @param mask Pins to update.
+ * @param value New levels.
+ */
+void gpio_write_mask(gpio_port_t port, uint16_t mask, uint16_t value) {
+    GPIO_TypeDef *gpio = get_gpio_port(port);
+
+    gpio->BSRR = ((uint32_t)(mask & value)) | ((uint32_t)(mask & (uint16_t)~value) << 16);
+}
+
+/**
+ * @brief Reads the whole input data register of a port.
+ *
+ * @param port Port index.
+ * @return uint16_t IDR contents.
+ */
+uint16_t gpio_read_port(gpio_port_t port) {
+    return (uint16_t)get_gpio_port(port)->IDR;
+}
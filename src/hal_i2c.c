@@ -0,0 +1,492 @@
+/**
+ * @file hal_i2c.c
+ * @brief Interrupt/DMA-driven I2C master implementation for STM32F446RE.
+ *
+ * Follows the RM0390 master sequences: SB → address, ADDR → choose byte or
+ * DMA mode, BTF/TXE/RXNE → data. Reception of 1, 2 and 3+ bytes differs in
+ * when ACK is cleared and when the stop is programmed, so the NACK lands on
+ * the last byte. The stop of a finished transaction becomes a repeated start
+ * when another one is queued. Direct register access only.
+ */
+
+#include <stdint.h>
+#include "hal_i2c.h"
+#include "hal_dma.h"
+#include "hal_rcc.h"
+#include "hal_nvic.h"
+
+/**
+ * @brief Transaction phase.
+ */
+typedef enum {
+    I2C_PHASE_WRITE = 0,   /**< Address + W, then `tx` */
+    I2C_PHASE_READ  = 1    /**< Address + R, then `rx` */
+} i2c_phase_t;
+
+/**
+ * @brief Per-bus state: queue and the running transaction.
+ */
+typedef struct {
+    i2c_xfer_t *queue[I2C_QUEUE_LEN];  /**< Submitted transactions, `queue[tail]` is running */
+    volatile uint8_t head;             /**< Free-running write index */
+    volatile uint8_t tail;             /**< Free-running read index */
+    i2c_xfer_t *cur;                   /**< Running transaction, or 0 */
+    uint16_t pos;                      /**< Bytes done in the current phase */
+    uint8_t phase;                     /**< `i2c_phase_t` */
+    uint8_t addressed;                 /**< ADDR seen for the current phase */
+    uint8_t dma;                       /**< Current phase runs on DMA */
+    uint8_t chained;                   /**< START for the next transaction already requested */
+    uint32_t cr2, ccr, trise;          /**< Timing restored after SWRST */
+    uint32_t stop_wait;                /**< Loop bound for a pending STOP (one SCL period) */
+} i2c_state_t;
+
+/// State of I2C1, I2C2, I2C3.
+static i2c_state_t i2c_state[3];
+
+/// Register blocks, same indexing as `i2c_state`.
+static I2C_TypeDef *const i2c_regs[3] = { I2C1, I2C2, I2C3 };
+
+/**
+ * @brief Maps an I2C instance to its table index.
+ *
+ * DMA requests and the event interrupt line come from the same descriptor
+ * (`periph_lookup()`); the error line follows the event line.
+ *
+ * @param i2c I2C peripheral.
+ * @return int 0–2, or -1 if unknown.
+ */
+static int i2c_index(I2C_TypeDef *i2c) {
+    return periph_index(i2c, PERIPH_KIND_I2C);
+}
+
+/**
+ * @brief Resets the per-phase fields for the transaction at the queue tail.
+ *
+ * Does not touch CR1: a chained START may still be pending there.
+ *
+ * @param st Bus state.
+ */
+static void i2c_begin(i2c_state_t *st) {
+    i2c_xfer_t *x = st->cur;
+
+    st->pos = 0;
+    st->addressed = 0;
+    st->dma = 0;
+    st->phase = (x->tx_len || !x->rx_len) ? I2C_PHASE_WRITE : I2C_PHASE_READ;
+}
+
+/**
+ * @brief Requests the START of the current transaction, unless already chained.
+ *
+ * CR1 must not be written while a STOP is still being generated, so a STOP
+ * set just before is let finish (bounded by one SCL period).
+ *
+ * @param st Bus state.
+ * @param i2c Registers.
+ */
+static void i2c_request_start(i2c_state_t *st, I2C_TypeDef *i2c) {
+    if (st->chained) {
+        st->chained = 0;
+        return;
+    }
+    for (uint32_t n = st->stop_wait; (i2c->CR1 & I2C_CR1_STOP) && n; n--);
+    i2c->CR1 |= I2C_CR1_START;
+}
+
+/**
+ * @brief Programs the end of the current transaction on the bus.
+ *
+ * A repeated START if another transaction is queued behind it, else STOP.
+ *
+ * @param st Bus state.
+ * @param i2c Registers.
+ */
+static void i2c_end(i2c_state_t *st, I2C_TypeDef *i2c) {
+    st->chained = ((uint8_t)(st->head - st->tail) > 1U);
+    i2c->CR1 |= st->chained ? I2C_CR1_START : I2C_CR1_STOP;
+}
+
+/**
+ * @brief Finishes the current transaction and moves to the next one.
+ *
+ * @param st Bus state.
+ * @param status Result for the finished transaction.
+ */
+static void i2c_complete(i2c_state_t *st, int8_t status) {
+    I2C_TypeDef *i2c = i2c_regs[st - i2c_state];
+    i2c_xfer_t *x = st->cur;
+
+    i2c->CR2 &= ~(I2C_CR2_ITBUFEN | I2C_CR2_DMAEN | I2C_CR2_LAST);
+    if (st->dma) {
+        const periph_desc_t *desc = periph_lookup(i2c);
+
+        if (st->phase == I2C_PHASE_READ) {
+            dma_stream_disable(&desc->dma_rx);
+            dma_stream_attach(&desc->dma_rx, 0, 0);
+        } else {
+            dma_stream_disable(&desc->dma_tx);
+        }
+    }
+
+    st->tail++;
+    st->cur = (st->head != st->tail) ? st->queue[st->tail & (I2C_QUEUE_LEN - 1U)] : 0;
+    if (st->cur) {
+        i2c_begin(st);
+        i2c_request_start(st, i2c);
+    } else {
+        st->chained = 0;
+    }
+
+    x->status = status;
+    if (x->cb) x->cb(x);
+}
+
+/**
+ * @brief Resets the peripheral and restores its timing (bus error recovery).
+ *
+ * @param st Bus state.
+ * @param i2c Registers.
+ */
+static void i2c_recover(i2c_state_t *st, I2C_TypeDef *i2c) {
+    i2c->CR1 = I2C_CR1_SWRST;
+    i2c->CR1 = 0;
+    i2c->CR2 = st->cr2;
+    i2c->CCR = st->ccr;
+    i2c->TRISE = st->trise;
+    i2c->CR1 = I2C_CR1_PE;
+    st->chained = 0;
+}
+
+/**
+ * @brief Starts a DMA stream for the current phase if it is idle.
+ *
+ * The stream's interrupt callback is only taken over once the stream is
+ * known to be free.
+ *
+ * @param req Stream.
+ * @param cr Direction and interrupt bits.
+ * @param i2c Registers (DR is the peripheral address).
+ * @param buf Payload.
+ * @param len Payload length.
+ * @param cb Stream callback, or 0 to leave the current one.
+ * @param ctx Callback context.
+ * @return int 1 if started, 0 if the stream is busy.
+ */
+static int i2c_dma_try(const dma_request_t *req, uint32_t cr, I2C_TypeDef *i2c,
+                       const void *buf, uint16_t len, dma_callback_t cb, void *ctx) {
+    uint32_t primask = irq_save();
+    int ok = !(dma_stream_get(req)->CR & DMA_SxCR_EN);
+
+    if (ok) {
+        if (cb) dma_stream_attach(req, cb, ctx);
+        dma_stream_start(req, cr | DMA_SxCR_MINC | DMA_SxCR_PL_MEDIUM, &i2c->DR, buf, len);
+    }
+    irq_restore(primask);
+    return ok;
+}
+
+/**
+ * @brief RX DMA stream callback: all bytes are in memory.
+ *
+ * LAST made the hardware NACK the final byte; the stop (or chained start)
+ * is programmed here as RM0390 requires for DMA reception.
+ *
+ * @param flags Pending stream flags.
+ * @param ctx Bus state.
+ */
+static void i2c_dma_rx_done(uint32_t flags, void *ctx) {
+    i2c_state_t *st = (i2c_state_t *)ctx;
+    I2C_TypeDef *i2c = i2c_regs[st - i2c_state];
+
+    if (!st->cur || !st->dma) return;
+    if (flags & DMA_FLAG_TEIF) {
+        i2c_recover(st, i2c);
+        i2c_complete(st, I2C_STATUS_BUS_ERROR);
+    } else if (flags & DMA_FLAG_TCIF) {
+        i2c_end(st, i2c);
+        i2c_complete(st, I2C_STATUS_DONE);
+    }
+}
+
+/**
+ * @brief ADDR event: sets up the data phase, then clears ADDR (SR1 then SR2 read).
+ *
+ * @param st Bus state.
+ * @param i2c Registers.
+ */
+static void i2c_addr_event(i2c_state_t *st, I2C_TypeDef *i2c) {
+    i2c_xfer_t *x = st->cur;
+    uint16_t n;
+
+    st->addressed = 1;
+
+    if (st->phase == I2C_PHASE_WRITE) {
+        if (x->tx_len == 0) {                                // address probe
+            (void)i2c->SR2;
+            i2c_end(st, i2c);
+            i2c_complete(st, I2C_STATUS_DONE);
+            return;
+        }
+        if (x->tx_len >= I2C_DMA_MIN_LEN &&
+            i2c_dma_try(&periph_lookup(i2c)->dma_tx, DMA_SxCR_DIR_M2P, i2c, x->tx, x->tx_len, 0, 0)) {
+            st->dma = 1;
+            st->pos = x->tx_len;                             // DMA owns the payload
+            i2c->CR2 |= I2C_CR2_DMAEN;
+        } else {
+            i2c->CR2 |= I2C_CR2_ITBUFEN;
+        }
+        (void)i2c->SR2;
+        return;
+    }
+
+    n = x->rx_len;
+    if (n >= I2C_DMA_MIN_LEN && n >= 2U &&
+        i2c_dma_try(&periph_lookup(i2c)->dma_rx, DMA_SxCR_DIR_P2M | DMA_SxCR_TCIE | DMA_SxCR_TEIE, i2c, x->rx, n,
+                    i2c_dma_rx_done, st)) {
+        st->dma = 1;
+        i2c->CR1 |= I2C_CR1_ACK;
+        i2c->CR2 |= I2C_CR2_DMAEN | I2C_CR2_LAST;
+        (void)i2c->SR2;
+        return;
+    }
+
+    if (n == 1U) {
+        i2c->CR1 &= ~I2C_CR1_ACK;                            // NACK the only byte
+        (void)i2c->SR2;
+        i2c_end(st, i2c);
+        i2c->CR2 |= I2C_CR2_ITBUFEN;
+    } else if (n == 2U) {
+        i2c->CR1 = (i2c->CR1 & ~I2C_CR1_ACK) | I2C_CR1_POS;  // NACK applies to the second byte
+        (void)i2c->SR2;
+    } else {
+        i2c->CR1 |= I2C_CR1_ACK;
+        (void)i2c->SR2;
+        if (n > 3U) i2c->CR2 |= I2C_CR2_ITBUFEN;             // last 3 bytes go by BTF
+    }
+}
+
+/**
+ * @brief Byte-mode reception (after ADDR of the read phase).
+ *
+ * @param st Bus state.
+ * @param i2c Registers.
+ * @param sr1 SR1 snapshot.
+ */
+static void i2c_read_event(i2c_state_t *st, I2C_TypeDef *i2c, uint32_t sr1) {
+    i2c_xfer_t *x = st->cur;
+    uint16_t rem = x->rx_len - st->pos;
+
+    if (rem == 1U) {
+        if (!(sr1 & I2C_SR1_RXNE)) return;
+        x->rx[st->pos++] = (uint8_t)i2c->DR;
+        i2c_complete(st, I2C_STATUS_DONE);
+    } else if (rem == 2U) {
+        if (!(sr1 & I2C_SR1_BTF)) return;                    // both bytes received, SCL stretched
+        i2c->CR1 &= ~I2C_CR1_POS;
+        i2c_end(st, i2c);
+        x->rx[st->pos++] = (uint8_t)i2c->DR;
+        x->rx[st->pos++] = (uint8_t)i2c->DR;
+        i2c_complete(st, I2C_STATUS_DONE);
+    } else if (rem == 3U) {
+        if (!(sr1 & I2C_SR1_BTF)) return;                    // N-2 in DR, N-1 in shift register
+        i2c->CR1 &= ~I2C_CR1_ACK;
+        x->rx[st->pos++] = (uint8_t)i2c->DR;
+    } else if (sr1 & I2C_SR1_RXNE) {
+        x->rx[st->pos++] = (uint8_t)i2c->DR;
+        if (x->rx_len - st->pos == 3U) i2c->CR2 &= ~I2C_CR2_ITBUFEN;
+    }
+}
+
+/**
+ * @brief Transmission (after ADDR of the write phase).
+ *
+ * BTF with nothing left to send means the last byte is out: continue with
+ * the read phase (repeated start) or end the transaction.
+ *
+ * @param st Bus state.
+ * @param i2c Registers.
+ * @param sr1 SR1 snapshot.
+ */
+static void i2c_write_event(i2c_state_t *st, I2C_TypeDef *i2c, uint32_t sr1) {
+    i2c_xfer_t *x = st->cur;
+
+    if (st->pos < x->tx_len) {
+        if (!(sr1 & (I2C_SR1_TXE | I2C_SR1_BTF))) return;
+        i2c->DR = x->tx[st->pos++];
+        if (st->pos == x->tx_len) i2c->CR2 &= ~I2C_CR2_ITBUFEN;
+        return;
+    }
+    if (!(sr1 & I2C_SR1_BTF)) return;
+
+    if (st->dma) {
+        i2c->CR2 &= ~I2C_CR2_DMAEN;
+        dma_stream_disable(&periph_lookup(i2c)->dma_tx);
+        st->dma = 0;
+    }
+    if (x->rx_len) {
+        st->phase = I2C_PHASE_READ;
+        st->pos = 0;
+        st->addressed = 0;
+        i2c->CR1 |= I2C_CR1_START;                           // repeated start, then address + R
+    } else {
+        i2c_end(st, i2c);
+        i2c_complete(st, I2C_STATUS_DONE);
+    }
+}
+
+/**
+ * @brief Event interrupt body.
+ *
+ * Pending read data is taken first: with a single-byte read and a chained
+ * START, RXNE and the next transaction's SB can be seen together.
+ *
+ * @param idx Bus index.
+ */
+static void i2c_ev_irq(int idx) {
+    i2c_state_t *st = &i2c_state[idx];
+    I2C_TypeDef *i2c = i2c_regs[idx];
+    uint32_t sr1 = i2c->SR1;
+
+    if (!st->cur) return;
+    if (st->phase == I2C_PHASE_READ && st->addressed && !st->dma) {
+        i2c_read_event(st, i2c, sr1);
+        if (!st->cur) return;
+    }
+
+    if (sr1 & I2C_SR1_SB) {
+        i2c->DR = ((uint32_t)st->cur->addr << 1) | st->phase;
+    } else if (sr1 & I2C_SR1_ADDR) {
+        i2c_addr_event(st, i2c);
+    } else if (st->phase == I2C_PHASE_WRITE && st->addressed) {
+        i2c_write_event(st, i2c, sr1);
+    }
+}
+
+/**
+ * @brief Error interrupt body.
+ *
+ * NACK: stop (or chained start) and fail the transaction. Bus error, lost
+ * arbitration and SCL timeout: reset the peripheral, fail the transaction
+ * and start the next one on the clean peripheral.
+ *
+ * @param idx Bus index.
+ */
+static void i2c_er_irq(int idx) {
+    i2c_state_t *st = &i2c_state[idx];
+    I2C_TypeDef *i2c = i2c_regs[idx];
+    uint32_t err = i2c->SR1 & I2C_SR1_ERR_MSK;
+
+    i2c->SR1 = ~err;                                         // rc_w0
+    if (!st->cur) return;
+
+    if (err & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_TIMEOUT)) {
+        i2c_recover(st, i2c);
+        i2c_complete(st, (err & I2C_SR1_ARLO) ? I2C_STATUS_ARB_LOST : I2C_STATUS_BUS_ERROR);
+    } else if (err & I2C_SR1_AF) {
+        i2c_end(st, i2c);
+        i2c_complete(st, I2C_STATUS_NACK);
+    }
+}
+
+/**
+ * @brief Initialize an I2C peripheral as interrupt-driven master.
+ *
+ * Standard mode: CCR = PCLK1 / (2 × speed), TRISE = 1000 ns. Fast mode
+ * (duty 2:1): CCR = PCLK1 / (3 × speed), TRISE = 300 ns. CCR is rounded up
+ * so SCL never exceeds the requested speed.
+ *
+ * @param i2c I2C peripheral.
+ * @param speed_hz SCL frequency.
+ * @return int 0 on success, -1 on invalid arguments.
+ */
+int i2c_init(I2C_TypeDef *i2c, uint32_t speed_hz) {
+    int idx = i2c_index(i2c);
+    uint32_t pclk1 = rcc_get_pclk(i2c);
+    uint32_t mhz = pclk1 / 1000000U;
+    i2c_state_t *st;
+    uint32_t ccr;
+    int8_t irqn;
+
+    if (idx < 0 || speed_hz < 10000U || speed_hz > 400000U || mhz < 2U || mhz > 50U) return -1;
+    st = &i2c_state[idx];
+
+    if (speed_hz > 100000U) {
+        ccr = (pclk1 + 3U * speed_hz - 1U) / (3U * speed_hz);
+        if (ccr < 1U) ccr = 1U;
+        st->ccr = I2C_CCR_FS | ccr;
+        st->trise = mhz * 300U / 1000U + 1U;
+    } else {
+        ccr = (pclk1 + 2U * speed_hz - 1U) / (2U * speed_hz);
+        if (ccr < 4U) ccr = 4U;
+        st->ccr = ccr;
+        st->trise = mhz + 1U;
+    }
+    st->cr2 = mhz | I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+    st->stop_wait = rcc_get_hclk_hz() / speed_hz;
+    st->head = 0;
+    st->tail = 0;
+    st->cur = 0;
+    st->chained = 0;
+
+    rcc_enable_i2c(i2c);
+    rcc_enable_dma(DMA1);
+    i2c_recover(st, i2c);
+
+    irqn = periph_lookup(i2c)->irqn;
+    nvic_enable_irq((IRQn_Type)irqn);                    // EV
+    nvic_enable_irq((IRQn_Type)(irqn + 1));              // ER
+    return 0;
+}
+
+/**
+ * @brief Queue a transaction.
+ *
+ * @param i2c I2C peripheral.
+ * @param x Transaction.
+ * @return int 0 if queued, -1 if full or invalid.
+ */
+int i2c_submit(I2C_TypeDef *i2c, i2c_xfer_t *x) {
+    int idx = i2c_index(i2c);
+    i2c_state_t *st;
+    uint32_t primask;
+
+    if (idx < 0 || !x || x->addr > 0x7FU) return -1;
+    if ((x->tx_len && !x->tx) || (x->rx_len && !x->rx)) return -1;
+    st = &i2c_state[idx];
+
+    primask = irq_save();
+    if ((uint8_t)(st->head - st->tail) >= I2C_QUEUE_LEN) {
+        irq_restore(primask);
+        return -1;
+    }
+
+    x->status = I2C_STATUS_PENDING;
+    st->queue[st->head & (I2C_QUEUE_LEN - 1U)] = x;
+    st->head++;
+    if (!st->cur) {
+        st->cur = x;
+        i2c_begin(st);
+        i2c_request_start(st, i2c);
+    }
+    irq_restore(primask);
+    return 0;
+}
+
+/**
+ * @brief Bus activity query.
+ *
+ * @param i2c I2C peripheral.
+ * @return int 1 if a transaction is queued or running.
+ */
+int i2c_busy(I2C_TypeDef *i2c) {
+    int idx = i2c_index(i2c);
+
+    return (idx >= 0 && i2c_state[idx].cur) ? 1 : 0;
+}
+
+void I2C1_EV_IRQHandler(void) { i2c_ev_irq(0); }
+void I2C1_ER_IRQHandler(void) { i2c_er_irq(0); }
+void I2C2_EV_IRQHandler(void) { i2c_ev_irq(1); }
+void I2C2_ER_IRQHandler(void) { i2c_er_irq(1); }
+void I2C3_EV_IRQHandler(void) { i2c_ev_irq(2); }
+void I2C3_ER_IRQHandler(void) { i2c_er_irq(2); }
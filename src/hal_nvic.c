@@ -0,0 +1,182 @@
+/**
+ * @file hal_nvic.c
+ * @brief NVIC driver implementation for STM32F446RE.
+ *
+ * Implements interrupt enable/priority/pending control for device IRQs and
+ * core exceptions, and relocation of the vector table to SRAM for runtime
+ * handler registration. Direct register access only.
+ */
+
+#include <stdint.h>
+#include "hal_nvic.h"
+
+/// Flash vector table defined in platform/stm32f4/startup.s.
+extern const uint32_t _vector_table[];
+
+/**
+ * @brief SRAM copy of the vector table.
+ *
+ * VTOR requires alignment to the next power of two above the table size
+ * (113 entries * 4 bytes = 452 bytes, so 512).
+ */
+static uint32_t ram_vectors[NVIC_VECTOR_COUNT] __attribute__((aligned(512)));
+
+/**
+ * @brief Enables a device interrupt (ISER).
+ *
+ * @param irqn Interrupt number.
+ */
+void nvic_enable_irq(IRQn_Type irqn) {
+    if (irqn < 0) return;
+    NVIC->ISER[(uint32_t)irqn >> 5] = (1U << ((uint32_t)irqn & 0x1F));
+}
+
+/**
+ * @brief Disables a device interrupt (ICER) and waits for it to take effect.
+ *
+ * @param irqn Interrupt number.
+ */
+void nvic_disable_irq(IRQn_Type irqn) {
+    if (irqn < 0) return;
+    NVIC->ICER[(uint32_t)irqn >> 5] = (1U << ((uint32_t)irqn & 0x1F));
+    HAL_DSB();
+    HAL_ISB();
+}
+
+/**
+ * @brief Writes the upper 4 bits of the IP/SHP byte for an interrupt.
+ *
+ * Core exceptions 4–15 map to SCB->SHP[0..11].
+ *
+ * @param irqn Interrupt number.
+ * @param priority Priority 0–15.
+ */
+void nvic_set_priority(IRQn_Type irqn, uint8_t priority) {
+    uint8_t value = (uint8_t)((priority << (8U - NVIC_PRIO_BITS)) & 0xFF);
+
+    if (irqn < 0) {
+        SCB->SHP[((uint32_t)irqn & 0xF) - 4U] = value;
+    } else {
+        NVIC->IP[(uint32_t)irqn] = value;
+    }
+}
+
+/**
+ * @brief Reads back the priority of an interrupt.
+ *
+ * @param irqn Interrupt number.
+ * @return uint8_t Priority 0–15.
+ */
+uint8_t nvic_get_priority(IRQn_Type irqn) {
+    uint8_t value;
+
+    if (irqn < 0) {
+        value = SCB->SHP[((uint32_t)irqn & 0xF) - 4U];
+    } else {
+        value = NVIC->IP[(uint32_t)irqn];
+    }
+
+    return (uint8_t)(value >> (8U - NVIC_PRIO_BITS));
+}
+
+/**
+ * @brief Updates AIRCR.PRIGROUP (the write key is mandatory).
+ *
+ * @param prigroup PRIGROUP value 0–7.
+ */
+void nvic_set_priority_grouping(uint8_t prigroup) {
+    uint32_t aircr = SCB->AIRCR;
+
+    aircr &= ~((0xFFFFU << 16) | SCB_AIRCR_PRIGROUP_MSK);
+    aircr |= SCB_AIRCR_VECTKEY | ((uint32_t)(prigroup & 0x7) << SCB_AIRCR_PRIGROUP_POS);
+    SCB->AIRCR = aircr;
+}
+
+/**
+ * @brief Reads AIRCR.PRIGROUP.
+ *
+ * @return uint8_t PRIGROUP value 0–7.
+ */
+uint8_t nvic_get_priority_grouping(void) {
+    return (uint8_t)((SCB->AIRCR & SCB_AIRCR_PRIGROUP_MSK) >> SCB_AIRCR_PRIGROUP_POS);
+}
+
+/**
+ * @brief Sets the pending bit of a device interrupt (ISPR).
+ *
+ * @param irqn Interrupt number.
+ */
+void nvic_set_pending(IRQn_Type irqn) {
+    if (irqn < 0) return;
+    NVIC->ISPR[(uint32_t)irqn >> 5] = (1U << ((uint32_t)irqn & 0x1F));
+}
+
+/**
+ * @brief Clears the pending bit of a device interrupt (ICPR).
+ *
+ * @param irqn Interrupt number.
+ */
+void nvic_clear_pending(IRQn_Type irqn) {
+    if (irqn < 0) return;
+    NVIC->ICPR[(uint32_t)irqn >> 5] = (1U << ((uint32_t)irqn & 0x1F));
+}
+
+/**
+ * @brief Reads the pending bit of a device interrupt.
+ *
+ * @param irqn Interrupt number.
+ * @return int 1 if pending.
+ */
+int nvic_is_pending(IRQn_Type irqn) {
+    if (irqn < 0) return 0;
+    return (NVIC->ISPR[(uint32_t)irqn >> 5] & (1U << ((uint32_t)irqn & 0x1F))) ? 1 : 0;
+}
+
+/**
+ * @brief Reads the active bit of a device interrupt.
+ *
+ * @param irqn Interrupt number.
+ * @return int 1 if active.
+ */
+int nvic_is_active(IRQn_Type irqn) {
+    if (irqn < 0) return 0;
+    return (NVIC->IABR[(uint32_t)irqn >> 5] & (1U << ((uint32_t)irqn & 0x1F))) ? 1 : 0;
+}
+
+/**
+ * @brief Copies the flash vector table to SRAM and switches VTOR to it.
+ */
+void nvic_relocate_vectors(void) {
+    if (SCB->VTOR == (uint32_t)(uintptr_t)ram_vectors) return;
+
+    uint32_t primask = irq_save();
+
+    for (uint32_t i = 0; i < NVIC_VECTOR_COUNT; i++) {
+        ram_vectors[i] = _vector_table[i];
+    }
+
+    SCB->VTOR = (uint32_t)(uintptr_t)ram_vectors;
+    HAL_DSB();
+    HAL_ISB();
+
+    irq_restore(primask);
+}
+
+/**
+ * @brief Writes a handler address into the SRAM vector table.
+ *
+ * @param irqn Interrupt number.
+ * @param handler Handler function.
+ * @return int 0 on success, -1 if `irqn` has no slot in the table.
+ */
+int nvic_register_handler(IRQn_Type irqn, nvic_handler_t handler) {
+    int32_t slot = 16 + (int32_t)irqn;
+
+    if (slot < 0 || slot >= (int32_t)NVIC_VECTOR_COUNT) return -1;
+
+    nvic_relocate_vectors();
+
+    ram_vectors[slot] = (uint32_t)(uintptr_t)handler;
+    HAL_DSB();
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file hal_periph.c
+ * @brief Peripheral descriptor table and constant-time lookup for STM32F446RE.
+ *
+ * Every peripheral instance is one row of `PERIPH_ROWS`. The row list is
+ * expanded three times: into an id enum, into the descriptor table (indexed
+ * by id) and into a 384-byte slot map that turns a base address into an id.
+ * A lookup is a range check, one byte load and one compare, whatever the
+ * number of peripherals.
+ */
+
+#include <stdint.h>
+#include "hal_periph.h"
+#include "stm32f4_nvic.h"
+#include "stm32f4_gpio.h"
+#include "stm32f4_tim.h"
+#include "stm32f4_uart.h"
+#include "stm32f4_spi.h"
+#include "stm32f4_i2c.h"
+#include "stm32f4_adc.h"
+#include "stm32f4_dac.h"
+#include "stm32f4_exti.h"
+#include "stm32f4_pwr.h"
+
+/// First address of the peripheral region (APB1).
+#define PERIPH_REGION_BASE 0x40000000UL
+
+/// Slot map size: APB1, APB2 and AHB1, 128 blocks of 256 bytes each (first 32 KB of the bus).
+#define PERIPH_SLOTS (3U * 128U)
+
+/// Slot of a base address: bus in bits 8:7, 256-byte block in bits 6:0.
+#define PERIPH_SLOT(base) \
+    (((((base) - PERIPH_REGION_BASE) >> 16) << 7) | (((base) >> 8) & 0x7FU))
+
+/// DMA request entry: controller, stream, channel.
+#define DREQ(d, s, c) { (d), (s), (c) }
+
+/// No DMA request.
+#define DMA_NONE      { 0, 0, 0 }
+
+/**
+ * Row list: name (base is `name##_BASE`), bus, enable bit, reset bit,
+ * clock, kind, unit, IRQ, RX/peripheral-to-memory DMA, TX/memory-to-peripheral DMA.
+ * DMA mappings are the ones the drivers use (RM0390 tables 28 and 29);
+ * TIM2_UP and TIM5_UP take their first choice (DMA1 stream 1 / 0) to stay
+ * off the USART2 transmit stream.
+ */
+#define PERIPH_ROWS(X)                                                                                                                        \
+    X(GPIOA,  RCC_BUS_AHB1,  0,  0, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   0, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOB,  RCC_BUS_AHB1,  1,  1, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   1, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOC,  RCC_BUS_AHB1,  2,  2, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   2, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOD,  RCC_BUS_AHB1,  3,  3, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   3, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOE,  RCC_BUS_AHB1,  4,  4, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   4, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOF,  RCC_BUS_AHB1,  5,  5, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   5, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOG,  RCC_BUS_AHB1,  6,  6, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   6, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(GPIOH,  RCC_BUS_AHB1,  7,  7, RCC_CLK_HCLK,     PERIPH_KIND_GPIO,   7, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(DMA1,   RCC_BUS_AHB1, 21, 21, RCC_CLK_HCLK,     PERIPH_KIND_DMA,    0, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(DMA2,   RCC_BUS_AHB1, 22, 22, RCC_CLK_HCLK,     PERIPH_KIND_DMA,    1, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(TIM2,   RCC_BUS_APB1,  0,  0, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,    1, TIM2_IRQn,               DMA_NONE,            DREQ(DMA1, 1, 3))  \
+    X(TIM3,   RCC_BUS_APB1,  1,  1, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,    2, TIM3_IRQn,               DMA_NONE,            DREQ(DMA1, 2, 5))  \
+    X(TIM4,   RCC_BUS_APB1,  2,  2, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,    3, TIM4_IRQn,               DMA_NONE,            DREQ(DMA1, 6, 2))  \
+    X(TIM5,   RCC_BUS_APB1,  3,  3, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,    4, TIM5_IRQn,               DMA_NONE,            DREQ(DMA1, 0, 6))  \
+    X(TIM6,   RCC_BUS_APB1,  4,  4, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,    6, TIM6_DAC_IRQn,           DMA_NONE,            DREQ(DMA1, 1, 7))  \
+    X(TIM7,   RCC_BUS_APB1,  5,  5, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,    7, TIM7_IRQn,               DMA_NONE,            DREQ(DMA1, 2, 1))  \
+    X(TIM12,  RCC_BUS_APB1,  6,  6, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,   11, TIM8_BRK_TIM12_IRQn,     DMA_NONE,            DMA_NONE)          \
+    X(TIM13,  RCC_BUS_APB1,  7,  7, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,   12, TIM8_UP_TIM13_IRQn,      DMA_NONE,            DMA_NONE)          \
+    X(TIM14,  RCC_BUS_APB1,  8,  8, RCC_CLK_APB1_TIM, PERIPH_KIND_TIM,   13, TIM8_TRG_COM_TIM14_IRQn, DMA_NONE,            DMA_NONE)          \
+    X(SPI2,   RCC_BUS_APB1, 14, 14, RCC_CLK_PCLK1,    PERIPH_KIND_SPI,    1, SPI2_IRQn,               DREQ(DMA1, 3, 0),    DREQ(DMA1, 4, 0))  \
+    X(SPI3,   RCC_BUS_APB1, 15, 15, RCC_CLK_PCLK1,    PERIPH_KIND_SPI,    2, SPI3_IRQn,               DREQ(DMA1, 0, 0),    DREQ(DMA1, 5, 0))  \
+    X(USART2, RCC_BUS_APB1, 17, 17, RCC_CLK_PCLK1,    PERIPH_KIND_UART,   1, USART2_IRQn,             DREQ(DMA1, 5, 4),    DREQ(DMA1, 6, 4))  \
+    X(USART3, RCC_BUS_APB1, 18, 18, RCC_CLK_PCLK1,    PERIPH_KIND_UART,   2, USART3_IRQn,             DREQ(DMA1, 1, 4),    DREQ(DMA1, 3, 4))  \
+    X(UART4,  RCC_BUS_APB1, 19, 19, RCC_CLK_PCLK1,    PERIPH_KIND_UART,   3, UART4_IRQn,              DREQ(DMA1, 2, 4),    DREQ(DMA1, 4, 4))  \
+    X(UART5,  RCC_BUS_APB1, 20, 20, RCC_CLK_PCLK1,    PERIPH_KIND_UART,   4, UART5_IRQn,              DREQ(DMA1, 0, 4),    DREQ(DMA1, 7, 4))  \
+    X(I2C1,   RCC_BUS_APB1, 21, 21, RCC_CLK_PCLK1,    PERIPH_KIND_I2C,    0, I2C1_EV_IRQn,            DREQ(DMA1, 0, 1),    DREQ(DMA1, 7, 1))  \
+    X(I2C2,   RCC_BUS_APB1, 22, 22, RCC_CLK_PCLK1,    PERIPH_KIND_I2C,    1, I2C2_EV_IRQn,            DREQ(DMA1, 3, 7),    DREQ(DMA1, 7, 7))  \
+    X(I2C3,   RCC_BUS_APB1, 23, 23, RCC_CLK_PCLK1,    PERIPH_KIND_I2C,    2, I2C3_EV_IRQn,            DREQ(DMA1, 2, 3),    DREQ(DMA1, 4, 3))  \
+    X(PWR,    RCC_BUS_APB1, 28, 28, RCC_CLK_PCLK1,    PERIPH_KIND_SYS,    1, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(DAC,    RCC_BUS_APB1, 29, 29, RCC_CLK_PCLK1,    PERIPH_KIND_DAC,    0, TIM6_DAC_IRQn,           DMA_NONE,            DREQ(DMA1, 5, 7))  \
+    X(TIM1,   RCC_BUS_APB2,  0,  0, RCC_CLK_APB2_TIM, PERIPH_KIND_TIM,    0, TIM1_UP_TIM10_IRQn,      DMA_NONE,            DREQ(DMA2, 5, 6))  \
+    X(TIM8,   RCC_BUS_APB2,  1,  1, RCC_CLK_APB2_TIM, PERIPH_KIND_TIM,    5, TIM8_UP_TIM13_IRQn,      DMA_NONE,            DREQ(DMA2, 1, 7))  \
+    X(USART1, RCC_BUS_APB2,  4,  4, RCC_CLK_PCLK2,    PERIPH_KIND_UART,   0, USART1_IRQn,             DREQ(DMA2, 2, 4),    DREQ(DMA2, 7, 4))  \
+    X(USART6, RCC_BUS_APB2,  5,  5, RCC_CLK_PCLK2,    PERIPH_KIND_UART,   5, USART6_IRQn,             DREQ(DMA2, 1, 5),    DREQ(DMA2, 6, 5))  \
+    X(ADC1,   RCC_BUS_APB2,  8,  8, RCC_CLK_PCLK2,    PERIPH_KIND_ADC,    0, ADC_IRQn,                DREQ(DMA2, 4, 0),    DMA_NONE)          \
+    X(ADC2,   RCC_BUS_APB2,  9,  8, RCC_CLK_PCLK2,    PERIPH_KIND_ADC,    1, ADC_IRQn,                DREQ(DMA2, 3, 1),    DMA_NONE)          \
+    X(ADC3,   RCC_BUS_APB2, 10,  8, RCC_CLK_PCLK2,    PERIPH_KIND_ADC,    2, ADC_IRQn,                DREQ(DMA2, 1, 2),    DMA_NONE)          \
+    X(SPI1,   RCC_BUS_APB2, 12, 12, RCC_CLK_PCLK2,    PERIPH_KIND_SPI,    0, SPI1_IRQn,               DREQ(DMA2, 2, 3),    DREQ(DMA2, 3, 3))  \
+    X(SPI4,   RCC_BUS_APB2, 13, 13, RCC_CLK_PCLK2,    PERIPH_KIND_SPI,    3, SPI4_IRQn,               DREQ(DMA2, 0, 4),    DREQ(DMA2, 1, 4))  \
+    X(SYSCFG, RCC_BUS_APB2, 14, 14, RCC_CLK_PCLK2,    PERIPH_KIND_SYS,    0, -1,                      DMA_NONE,            DMA_NONE)          \
+    X(TIM9,   RCC_BUS_APB2, 16, 16, RCC_CLK_APB2_TIM, PERIPH_KIND_TIM,    8, TIM1_BRK_TIM9_IRQn,      DMA_NONE,            DMA_NONE)          \
+    X(TIM10,  RCC_BUS_APB2, 17, 17, RCC_CLK_APB2_TIM, PERIPH_KIND_TIM,    9, TIM1_UP_TIM10_IRQn,      DMA_NONE,            DMA_NONE)          \
+    X(TIM11,  RCC_BUS_APB2, 18, 18, RCC_CLK_APB2_TIM, PERIPH_KIND_TIM,   10, TIM1_TRG_COM_TIM11_IRQn, DMA_NONE,            DMA_NONE)
+
+/// Row ids; 0 marks an empty slot.
+enum {
+    PERIPH_ID_NONE = 0,
+#define PERIPH_ID(name, bus, en, rst, clk, kind, unit, irq, rx, tx) PERIPH_ID_##name,
+    PERIPH_ROWS(PERIPH_ID)
+#undef PERIPH_ID
+    PERIPH_ID_COUNT
+};
+
+/// Descriptors, indexed by row id.
+static const periph_desc_t periph_table[PERIPH_ID_COUNT] = {
+#define PERIPH_DESC(name, bus, en, rst, clk, kind, unit, irq, rx, tx) \
+    [PERIPH_ID_##name] = { name##_BASE, bus, en, rst, clk, kind, unit, irq, rx, tx },
+    PERIPH_ROWS(PERIPH_DESC)
+#undef PERIPH_DESC
+};
+
+/// Base address slot to row id.
+static const uint8_t periph_slot[PERIPH_SLOTS] = {
+#define PERIPH_MAP(name, bus, en, rst, clk, kind, unit, irq, rx, tx) \
+    [PERIPH_SLOT(name##_BASE)] = PERIPH_ID_##name,
+    PERIPH_ROWS(PERIPH_MAP)
+#undef PERIPH_MAP
+};
+
+/**
+ * @brief Finds the descriptor of a peripheral instance in O(1).
+ *
+ * Addresses outside the three mapped buses, and addresses that are not an
+ * instance's exact base (e.g. a register inside it), return 0.
+ *
+ * @param periph Peripheral base pointer.
+ * @return const periph_desc_t* Descriptor, or 0 if unknown.
+ */
+const periph_desc_t *periph_lookup(const volatile void *periph) {
+    uint32_t addr = (uint32_t)(uintptr_t)periph;
+    uint32_t off = addr - PERIPH_REGION_BASE;             // wraps for addresses below the region
+
+    if (off >= 0x30000UL || (off & 0xFFFFUL) >= 0x8000UL) return 0;
+
+    const periph_desc_t *desc = &periph_table[periph_slot[PERIPH_SLOT(addr)]];
+    return (desc->base == addr) ? desc : 0;               // id 0 has base 0, never equal
+}
+
+/**
+ * @brief Returns a peripheral's row in its driver's state arrays, checking its type.
+ *
+ * @param periph Peripheral base pointer.
+ * @param kind Expected type.
+ * @return int Unit index, or -1 if unknown or of another type.
+ */
+int periph_index(const volatile void *periph, periph_kind_t kind) {
+    const periph_desc_t *desc = periph_lookup(periph);
+    return (desc && desc->kind == kind) ? desc->unit : -1;
+}
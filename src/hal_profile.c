@@ -0,0 +1,180 @@
+/**
+ * @file hal_profile.c
+ * @brief DWT cycle-counter profiling implementation for STM32F446RE.
+ *
+ * Keeps a static statistics table indexed by region id, updated with
+ * interrupts masked so regions can be recorded from ISRs, and formats it over
+ * a UART without any C library dependency.
+ */
+
+#include <stdint.h>
+#include "hal_profile.h"
+#include "hal_uart.h"
+#include "hal_nvic.h"
+#include "hal_systick.h"
+
+/// Statistics table, one entry per region id.
+static profile_region_t profile_table[PROFILE_MAX_REGIONS];
+
+/// Cycles taken by an empty `PROFILE_BEGIN` / `PROFILE_END` pair.
+static uint32_t profile_overhead;
+
+/**
+ * @brief Clears the counters of one table entry.
+ *
+ * @param r Table entry.
+ */
+static void profile_clear(profile_region_t *r) {
+    r->count = 0;
+    r->min = 0xFFFFFFFFU;
+    r->max = 0;
+    r->total = 0;
+}
+
+/**
+ * @brief Turns on trace, starts CYCCNT and measures the empty-region cost.
+ */
+void profile_init(void) {
+    DEMCR |= DEMCR_TRCENA;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+
+    profile_overhead = 0;
+    profile_reset();
+
+    // Smallest of a few empty measurements, recorded the same way PROFILE_END does
+    uint32_t best = 0xFFFFFFFFU;
+    for (uint32_t i = 0; i < 8; i++) {
+        uint32_t t0 = profile_cycles();
+        uint32_t dt = profile_cycles() - t0;
+        if (dt < best) best = dt;
+    }
+    profile_overhead = best;
+}
+
+/**
+ * @brief Resets count/min/max/total of every region.
+ */
+void profile_reset(void) {
+    uint32_t primask = irq_save();
+
+    for (uint32_t i = 0; i < PROFILE_MAX_REGIONS; i++) {
+        profile_clear(&profile_table[i]);
+    }
+
+    irq_restore(primask);
+}
+
+/**
+ * @brief Stores the label of a region.
+ *
+ * @param id Region id.
+ * @param name Label.
+ */
+void profile_set_name(uint8_t id, const char *name) {
+    if (id >= PROFILE_MAX_REGIONS) return;
+    profile_table[id].name = name;
+}
+
+/**
+ * @brief Accumulates one measurement (minus calibrated overhead).
+ *
+ * @param id Region id.
+ * @param cycles Raw elapsed cycles.
+ */
+void profile_record(uint8_t id, uint32_t cycles) {
+    if (id >= PROFILE_MAX_REGIONS) return;
+
+    profile_region_t *r = &profile_table[id];
+    cycles = (cycles > profile_overhead) ? cycles - profile_overhead : 0;
+
+    uint32_t primask = irq_save();
+    r->count++;
+    r->total += cycles;
+    if (cycles < r->min) r->min = cycles;
+    if (cycles > r->max) r->max = cycles;
+    irq_restore(primask);
+}
+
+/**
+ * @brief Returns a pointer into the statistics table.
+ *
+ * @param id Region id.
+ * @return const profile_region_t* Entry, or 0.
+ */
+const profile_region_t *profile_get(uint8_t id) {
+    if (id >= PROFILE_MAX_REGIONS) return 0;
+    return &profile_table[id];
+}
+
+/**
+ * @brief Computes total / count for a region.
+ *
+ * @param id Region id.
+ * @return uint32_t Mean cycles, or 0.
+ */
+uint32_t profile_mean(uint8_t id) {
+    if (id >= PROFILE_MAX_REGIONS || profile_table[id].count == 0) return 0;
+    return (uint32_t)(profile_table[id].total / profile_table[id].count);
+}
+
+/**
+ * @brief Formats an unsigned value right-aligned in a fixed-width field.
+ *
+ * @param buf Output buffer, at least `width + 1` bytes (and at least 11).
+ * @param value Value to format.
+ * @param width Minimum field width; padded with spaces on the left.
+ * @return char* `buf`, NUL-terminated.
+ */
+static char *profile_utoa(char *buf, uint32_t value, uint8_t width) {
+    char tmp[10];
+    uint8_t n = 0;
+    uint8_t i = 0;
+
+    do {
+        tmp[n++] = (char)('0' + value % 10U);
+        value /= 10U;
+    } while (value);
+
+    while (i + n < width) buf[i++] = ' ';
+    while (n) buf[i++] = tmp[--n];
+    buf[i] = '\0';
+
+    return buf;
+}
+
+/**
+ * @brief Prints the header and one line per used region.
+ *
+ * @param uart Output UART.
+ */
+void profile_dump(UART_TypeDef *uart) {
+    char num[12];
+
+    uart_print(uart, "profile @ ");
+    uart_print(uart, profile_utoa(num, SystemCoreClock, 0));
+    uart_print(uart, " Hz (cycles)\r\n id  count    min   mean    max  name\r\n");
+
+    for (uint8_t id = 0; id < PROFILE_MAX_REGIONS; id++) {
+        const profile_region_t *r = &profile_table[id];
+
+        // Snapshot field by field so an ISR can't update the entry halfway through
+        uint32_t primask = irq_save();
+        uint32_t count = r->count;
+        uint32_t min = r->min;
+        uint32_t max = r->max;
+        uint64_t total = r->total;
+        irq_restore(primask);
+
+        if (count == 0) continue;
+
+        uart_print(uart, profile_utoa(num, id, 3));
+        uart_print(uart, profile_utoa(num, count, 7));
+        uart_print(uart, profile_utoa(num, min, 7));
+        uart_print(uart, profile_utoa(num, (uint32_t)(total / count), 7));
+        uart_print(uart, profile_utoa(num, max, 7));
+        uart_print(uart, "  ");
+        uart_print(uart, r->name ? r->name : "-");
+        uart_print(uart, "\r\n");
+    }
+}
@@ -3,7 +3,11 @@
  * @brief RCC peripheral clock enable implementation for STM32F4 series.
  *
  * Contains implementation of high-level RCC utility functions for enabling
- * peripheral clocks (GPIO, UART, SPI, TIM) by writing to AHB and APB RCC registers.
+ * peripheral clocks by writing to AHB and APB RCC registers, and the clock
+ * tree setup (oscillators, PLL, flash latency, over-drive, prescalers).
+ * Bus, bit and clock of each peripheral come from the descriptor table in
+ * hal_periph.c, so enabling, resetting and clock queries are table lookups
+ * rather than per-type comparison chains.
  */
 
 
@@ -12,77 +16,542 @@
 #include "hal_tim.h"
 #include "hal_rcc.h"
 #include "hal_uart.h"
+#include "hal_dma.h"
+#include "hal_systick.h"
+#include "stm32f4_flash.h"
+#include "stm32f4_pwr.h"
+#include "stm32f4_exti.h"
+#include "hal_bitband.h"
+#include "hal_nvic.h"
+
+/// Iterations to wait for an oscillator / PLL / regulator ready flag before giving up.
+#define RCC_READY_TIMEOUT 100000U
+
+/// HSE frequency recorded by rcc_clock_config(), used to read back SYSCLK.
+static uint32_t rcc_hse_hz = HSE_VALUE;
 
 /**
  * @brief Enables the clock for a GPIO port.
  *
+ * Single bit-band store: atomic with respect to ISRs enabling other clocks.
+ *
  * @param port_index Index of GPIO port (0 = GPIOA, 1 = GPIOB, etc.).
  */
 void rcc_enable_gpio(uint16_t port_index){
-    RCC->AHB1ENR |= (1 << port_index);
+    BITBAND_PERIPH(&RCC->AHB1ENR, port_index) = 1;
+}
+
+/**
+ * @brief Enables several GPIO port clocks in `RCC->AHB1ENR` at once.
+ *
+ * GPIOA–GPIOH are bits 0–7, so the mask maps directly. The read-back gives
+ * the clock the two cycles it needs before the ports are accessed.
+ *
+ * @param port_mask Bit n set enables port n.
+ */
+void rcc_enable_gpio_mask(uint8_t port_mask){
+    uint32_t primask = irq_save();                // several bits: keep the RMW atomic
+    RCC->AHB1ENR |= port_mask;
+    irq_restore(primask);
+    (void)RCC->AHB1ENR;
 }
 
 /**
  * @brief Generic RCC bus register enable function.
  *
- * Sets the given bit in the provided RCC register.
+ * Sets the given bit in the provided RCC register through its bit-band alias.
  *
  * @param reg Pointer to RCC register (e.g., &RCC->APB1ENR).
  * @param bit_pos Bit position to enable.
  */
 void rcc_enable_bus(volatile uint32_t *reg, uint8_t bit_pos){
-    *reg |= (1U << bit_pos);    
+    BITBAND_PERIPH(reg, bit_pos) = 1;
 }
 
 /**
- * @brief Enables the clock for a specific UART peripheral.
+ * @brief Enables the clock of any peripheral in the descriptor table.
+ *
+ * Single bit-band store on `&RCC->AHB1ENR + bus`, followed by a read-back so
+ * the peripheral can be accessed right after the call.
+ *
+ * @param periph Peripheral base pointer.
+ * @return int 0 on success, -1 if `periph` is unknown.
+ */
+int rcc_enable_periph(const volatile void *periph) {
+    const periph_desc_t *d = periph_lookup(periph);
+    if (!d) return -1;
+
+    volatile uint32_t *enr = &RCC->AHB1ENR + d->bus;
+    BITBAND_PERIPH(enr, d->en_bit) = 1;
+    (void)*enr;
+    return 0;
+}
+
+/**
+ * @brief Pulses the reset bit of a peripheral, returning its registers to reset values.
+ *
+ * ADC1–3 share one reset bit, so resetting any of them resets all three.
+ *
+ * @param periph Peripheral base pointer.
+ * @return int 0 on success, -1 if `periph` is unknown.
+ */
+int rcc_reset_periph(const volatile void *periph) {
+    const periph_desc_t *d = periph_lookup(periph);
+    if (!d) return -1;
+
+    volatile uint32_t *rstr = &RCC->AHB1RSTR + d->bus;
+    BITBAND_PERIPH(rstr, d->rst_bit) = 1;
+    BITBAND_PERIPH(rstr, d->rst_bit) = 0;
+    return 0;
+}
+
+/**
+ * @brief Enables several peripheral clocks with one write per bus register.
  *
- * Determines the APB bus and appropriate bit position for the given UART.
+ * All entries are looked up first, so nothing is enabled if one is unknown.
+ * The enable bits are then OR-ed per bus and each touched register gets a
+ * single read-modify-write inside one critical section, instead of one
+ * bit-band store and read-back per peripheral.
+ *
+ * @param periphs Peripheral base pointers.
+ * @param n Number of entries.
+ * @return int 0 on success, -1 if any entry is unknown.
+ */
+int rcc_enable_many(const volatile void *const *periphs, uint8_t n) {
+    uint32_t mask[RCC_BUS_APB2 + 1] = { 0 };
+
+    for (uint8_t i = 0; i < n; i++) {
+        const periph_desc_t *d = periph_lookup(periphs[i]);
+        if (!d) return -1;
+        mask[d->bus] |= 1UL << d->en_bit;
+    }
+
+    uint32_t primask = irq_save();
+    for (uint8_t bus = 0; bus <= RCC_BUS_APB2; bus++) {
+        if (mask[bus]) (&RCC->AHB1ENR)[bus] |= mask[bus];
+    }
+    irq_restore(primask);
+
+    for (uint8_t bus = 0; bus <= RCC_BUS_APB2; bus++) {
+        if (mask[bus]) (void)(&RCC->AHB1ENR)[bus];    // delay after clock enable
+    }
+    return 0;
+}
+
+/**
+ * @brief Enables the clock for a specific UART peripheral.
  *
  * @param uart Pointer to UART peripheral base (e.g., USART1, USART2).
  */
 void rcc_enable_uart(UART_TypeDef *uart) {
-    if      (uart == USART1) RCC->APB2ENR |= (1 << 4);   // USART1 = bit 4 on APB2
-    else if (uart == USART2) RCC->APB1ENR |= (1 << 17);  // USART2 = bit 17 on APB1
-    else if (uart == USART3) RCC->APB1ENR |= (1 << 18);  // USART3 = bit 18 on APB1
-    else if (uart == UART4)  RCC->APB1ENR |= (1 << 19);  // UART4  = bit 19 on APB1
-    else if (uart == UART5)  RCC->APB1ENR |= (1 << 20);  // UART5  = bit 20 on APB1
-    else if (uart == USART6) RCC->APB2ENR |= (1 << 5);   // USART6 = bit 5 on APB2
+    rcc_enable_periph(uart);
 }
 
-
 /**
  * @brief Enables the clock for a TIM peripheral.
  *
- * Determines whether the timer is on APB1 or APB2 and enables its clock accordingly.
- *
  * @param timx Pointer to TIM peripheral (e.g., TIM2, TIM3, TIM1).
  */
 void rcc_enable_tim(TIM_TypeDef *timx){
-    if (timx == TIM1)      RCC->APB2ENR |= (1U << 11); // TIM1EN
-    else if (timx == TIM8) RCC->APB2ENR |= (1U << 13); // TIM8EN
-    else if (timx == TIM2) RCC->APB1ENR |= (1U << 0);  // TIM2EN
-    else if (timx == TIM3) RCC->APB1ENR |= (1U << 1);  // TIM3EN
-    else if (timx == TIM4) RCC->APB1ENR |= (1U << 2);  // TIM4EN
-    else if (timx == TIM5) RCC->APB1ENR |= (1U << 3);  // TIM5EN
-    else if (timx == TIM6) RCC->APB1ENR |= (1U << 4);  // TIM6EN
-    else if (timx == TIM7) RCC->APB1ENR |= (1U << 5);  // TIM7EN
-    else if (timx == TIM12) RCC->APB1ENR |= (1U << 6); // TIM12EN
-    else if (timx == TIM13) RCC->APB1ENR |= (1U << 7); // TIM13EN
-    else if (timx == TIM14) RCC->APB1ENR |= (1U << 8); // TIM14EN
-    else return; 
+    rcc_enable_periph(timx);
 }
 
 /**
  * @brief Enables the clock for a SPI peripheral.
  *
- * Identifies the correct RCC register and bit to enable SPI peripheral clocks.
- *
  * @param spix Pointer to SPI peripheral (e.g., SPI1, SPI2, SPI3).
  */
-void rcc_enable_spi(SPI_TypeDef * spix){ 
-    if (spix == SPI1) RCC->APB2ENR |= (1 << 12);        // enables SPI1EN
-    else if (spix == SPI2) RCC->APB1ENR |= (1 << 14);   // enables SPI2EN
-    else if (spix == SPI3) RCC->APB1ENR |= (1 << 15);   // enables SPI3EN
-    else if (spix == SPI4) RCC->APB2ENR |= (1 << 13);   // enables SPI4EN
-}
\ No newline at end of file
+void rcc_enable_spi(SPI_TypeDef * spix){
+    rcc_enable_periph(spix);
+}
+
+/**
+ * @brief Enables the clock for a DMA controller.
+ *
+ * @param dma Pointer to DMA controller (DMA1 or DMA2).
+ */
+void rcc_enable_dma(DMA_TypeDef *dma){
+    rcc_enable_periph(dma);
+}
+
+/**
+ * @brief Enables the clock for an ADC.
+ *
+ * @param adc Pointer to ADC peripheral (ADC1, ADC2 or ADC3).
+ */
+void rcc_enable_adc(ADC_TypeDef *adc){
+    rcc_enable_periph(adc);
+}
+
+/**
+ * @brief Enables the clock for the DAC (both channels).
+ */
+void rcc_enable_dac(void){
+    rcc_enable_periph(DAC);
+}
+
+/**
+ * @brief Enables the clock for an I2C peripheral.
+ *
+ * @param i2c Pointer to I2C peripheral (I2C1, I2C2 or I2C3).
+ */
+void rcc_enable_i2c(I2C_TypeDef *i2c){
+    rcc_enable_periph(i2c);
+}
+
+/**
+ * @brief Enables the clock for the system configuration controller.
+ */
+void rcc_enable_syscfg(void){
+    rcc_enable_periph(SYSCFG);
+}
+
+
+/**
+ * @brief Shift amount for an AHB prescaler code (CFGR.HPRE).
+ *
+ * Codes 0xxx = /1, 1000 = /2 ... 1111 = /512 (there is no /32).
+ *
+ * @param hpre 4-bit HPRE field.
+ * @return uint8_t log2 of the divider.
+ */
+static uint8_t rcc_ahb_shift(uint32_t hpre) {
+    static const uint8_t shift[8] = { 1, 2, 3, 4, 6, 7, 8, 9 };
+    return (hpre & 0x8) ? shift[hpre & 0x7] : 0;
+}
+
+/**
+ * @brief Shift amount for an APB prescaler code (CFGR.PPRE1/PPRE2).
+ *
+ * Codes 0xx = /1, 100 = /2 ... 111 = /16.
+ *
+ * @param ppre 3-bit PPRE field.
+ * @return uint8_t log2 of the divider.
+ */
+static uint8_t rcc_apb_shift(uint32_t ppre) {
+    return (ppre & 0x4) ? (uint8_t)((ppre & 0x3) + 1) : 0;
+}
+
+/**
+ * @brief Converts an AHB divider (1–512) to its HPRE code.
+ *
+ * @param div Divider; invalid values fall back to /1.
+ * @return uint32_t 4-bit HPRE code.
+ */
+static uint32_t rcc_ahb_code(uint16_t div) {
+    for (uint32_t code = 0; code < 8; code++) {
+        if ((1U << rcc_ahb_shift(0x8 | code)) == div) return 0x8 | code;
+    }
+    return 0;
+}
+
+/**
+ * @brief Converts an APB divider to its PPRE code, or picks one for a bus limit.
+ *
+ * @param div Divider 1–16, or 0 to choose the smallest divider meeting `max_hz`.
+ * @param hclk AHB clock in Hz.
+ * @param max_hz Highest allowed bus frequency.
+ * @return uint32_t 3-bit PPRE code.
+ */
+static uint32_t rcc_apb_code(uint8_t div, uint32_t hclk, uint32_t max_hz) {
+    uint32_t shift = 0;
+
+    if (div == 0) {
+        while (shift < 4 && (hclk >> shift) > max_hz) shift++;
+    } else {
+        while (shift < 4 && (1U << shift) < div) shift++;
+    }
+
+    return shift ? (0x4 | (shift - 1)) : 0;
+}
+
+/**
+ * @brief Flash wait states for a given HCLK at 2.7–3.6 V (RM0390 table 5).
+ *
+ * One extra wait state per 30 MHz.
+ *
+ * @param hclk AHB clock in Hz.
+ * @return uint32_t Number of wait states (0–5).
+ */
+static uint32_t rcc_flash_latency(uint32_t hclk) {
+    return (hclk - 1U) / 30000000U;
+}
+
+/**
+ * @brief Programs flash wait states and enables prefetch and the ART caches.
+ *
+ * The caches are flushed while disabled so no stale lines survive a latency change.
+ *
+ * @param latency Wait states.
+ */
+static void rcc_set_flash(uint32_t latency) {
+    FLASH->ACR &= ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+    FLASH->ACR |= FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+    FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+
+    FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_LATENCY_MSK) | (latency & FLASH_ACR_LATENCY_MSK)
+               | FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+
+    while ((FLASH->ACR & FLASH_ACR_LATENCY_MSK) != latency);   // takes effect on read-back
+}
+
+/**
+ * @brief Waits for a status bit to reach a value, with a timeout.
+ *
+ * @param reg Register to poll.
+ * @param mask Bit(s) to check.
+ * @param set 1 to wait for set, 0 to wait for clear.
+ * @return int 0 on success, -1 on timeout.
+ */
+static int rcc_wait(volatile uint32_t *reg, uint32_t mask, int set) {
+    for (uint32_t i = 0; i < RCC_READY_TIMEOUT; i++) {
+        if (((*reg & mask) != 0) == (set != 0)) return 0;
+    }
+    return -1;
+}
+
+/**
+ * @brief Switches SYSCLK and waits until the switch status confirms it.
+ *
+ * @param sw RCC_CFGR_SW_* value.
+ */
+static void rcc_switch_sysclk(uint32_t sw) {
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW_MSK) | sw;
+    while (((RCC->CFGR >> RCC_CFGR_SWS_POS) & 0x3) != sw);
+}
+
+/**
+ * @brief Finds PLL M/N/P giving exactly `sysclk` from `src_hz`.
+ *
+ * Prefers the highest VCO input frequency (smallest M) for lowest jitter.
+ *
+ * @param src_hz PLL input frequency.
+ * @param sysclk Target SYSCLK.
+ * @param m Output: M divider.
+ * @param n Output: N multiplier.
+ * @param p Output: P divider (2, 4, 6 or 8).
+ * @return int 0 if a solution exists, -1 otherwise.
+ */
+static int rcc_solve_pll(uint32_t src_hz, uint32_t sysclk, uint32_t *m, uint32_t *n, uint32_t *p) {
+    for (uint32_t pm = 2; pm <= 63; pm++) {
+        if (src_hz % pm) continue;
+        uint32_t vco_in = src_hz / pm;
+        if (vco_in > 2000000U) continue;
+        if (vco_in < 1000000U) break;
+
+        for (uint32_t pp = 2; pp <= 8; pp += 2) {
+            uint32_t vco = sysclk * pp;
+            if (vco < 100000000U || vco > 432000000U || (vco % vco_in)) continue;
+
+            uint32_t pn = vco / vco_in;
+            if (pn < 50 || pn > 432) continue;
+
+            *m = pm; *n = pn; *p = pp;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Brings up the oscillator, PLL, regulator, flash and prescalers.
+ *
+ * Runs from HSI while the PLL is reprogrammed, so it can be called again to
+ * change frequency at runtime.
+ *
+ * @param cfg Clock configuration.
+ * @return int 0 on success, -1 on failure (SYSCLK left on HSI).
+ */
+int rcc_clock_config(const rcc_clock_config_t *cfg) {
+    uint32_t src_hz = HSI_VALUE;
+    uint32_t use_pll;
+    uint32_t m = 0, n = 0, p = 2;
+
+    if (cfg->source == RCC_SRC_HSE) src_hz = cfg->hse_hz ? cfg->hse_hz : HSE_VALUE;
+    if (cfg->sysclk_hz == 0 || cfg->sysclk_hz > 180000000U) return -1;
+
+    use_pll = (cfg->sysclk_hz != src_hz);
+    if (use_pll && rcc_solve_pll(src_hz, cfg->sysclk_hz, &m, &n, &p) != 0) return -1;
+
+    uint32_t hpre = rcc_ahb_code(cfg->ahb_div ? cfg->ahb_div : 1);
+    uint32_t hclk = cfg->sysclk_hz >> rcc_ahb_shift(hpre);
+    uint32_t ppre1 = rcc_apb_code(cfg->apb1_div, hclk, 45000000U);
+    uint32_t ppre2 = rcc_apb_code(cfg->apb2_div, hclk, 90000000U);
+
+    // Run from HSI with safe prescalers while everything else changes
+    RCC->CR |= RCC_CR_HSION;
+    if (rcc_wait(&RCC->CR, RCC_CR_HSIRDY, 1) != 0) return -1;
+    rcc_set_flash(5);
+    RCC->CFGR |= (0x5U << RCC_CFGR_PPRE1_POS) | (0x4U << RCC_CFGR_PPRE2_POS);
+    rcc_switch_sysclk(RCC_CFGR_SW_HSI);
+    RCC->CR &= ~RCC_CR_PLLON;
+    if (rcc_wait(&RCC->CR, RCC_CR_PLLRDY, 0) != 0) return -1;
+
+    // Regulator scale 1 allows the full range; over-drive is added above 168 MHz
+    rcc_enable_periph(PWR);                               // PWREN, read back before use
+    PWR->CR = (PWR->CR & ~PWR_CR_VOS_MSK) | PWR_CR_VOS_SCALE1;
+    PWR->CR &= ~(PWR_CR_ODEN | PWR_CR_ODSWEN);
+
+    if (cfg->source == RCC_SRC_HSE) {
+        if (cfg->hse_bypass) RCC->CR |= RCC_CR_HSEBYP;
+        else                 RCC->CR &= ~RCC_CR_HSEBYP;
+        RCC->CR |= RCC_CR_HSEON;
+        if (rcc_wait(&RCC->CR, RCC_CR_HSERDY, 1) != 0) return -1;
+    }
+
+    if (use_pll) {
+        uint32_t q = (src_hz / m * n + 47999999U) / 48000000U;   // USB/SDIO domain <= 48 MHz
+        if (q < 2) q = 2;
+        if (q > 15) q = 15;
+
+        RCC->PLLCFGR = (m << RCC_PLLCFGR_PLLM_POS)
+                     | (n << RCC_PLLCFGR_PLLN_POS)
+                     | (((p >> 1) - 1) << RCC_PLLCFGR_PLLP_POS)
+                     | ((cfg->source == RCC_SRC_HSE) ? RCC_PLLCFGR_PLLSRC_HSE : 0)
+                     | (q << RCC_PLLCFGR_PLLQ_POS)
+                     | (2U << RCC_PLLCFGR_PLLR_POS);
+
+        RCC->CR |= RCC_CR_PLLON;
+        if (rcc_wait(&RCC->CR, RCC_CR_PLLRDY, 1) != 0) return -1;
+        if (rcc_wait(&PWR->CSR, PWR_CSR_VOSRDY, 1) != 0) return -1;
+
+        if (hclk > 168000000U) {
+            PWR->CR |= PWR_CR_ODEN;
+            if (rcc_wait(&PWR->CSR, PWR_CSR_ODRDY, 1) != 0) return -1;
+            PWR->CR |= PWR_CR_ODSWEN;
+            if (rcc_wait(&PWR->CSR, PWR_CSR_ODSWRDY, 1) != 0) return -1;
+        }
+    }
+
+    // Flash already at 5 WS (valid for any clock); set bus prescalers, switch, then trim latency
+    uint32_t cfgr = RCC->CFGR;
+    cfgr &= ~((0xFU << RCC_CFGR_HPRE_POS) | (0x7U << RCC_CFGR_PPRE1_POS) | (0x7U << RCC_CFGR_PPRE2_POS));
+    cfgr |= (hpre << RCC_CFGR_HPRE_POS) | (ppre1 << RCC_CFGR_PPRE1_POS) | (ppre2 << RCC_CFGR_PPRE2_POS);
+    RCC->CFGR = cfgr;
+
+    if (use_pll) rcc_switch_sysclk(RCC_CFGR_SW_PLL);
+    else if (cfg->source == RCC_SRC_HSE) rcc_switch_sysclk(RCC_CFGR_SW_HSE);
+
+    rcc_set_flash(rcc_flash_latency(hclk));
+
+    if (cfg->source == RCC_SRC_HSE) rcc_hse_hz = src_hz;
+    rcc_update_system_core_clock();
+
+    return 0;
+}
+
+/**
+ * @brief Reads SWS and PLLCFGR back to compute SYSCLK.
+ *
+ * @return uint32_t SYSCLK in Hz.
+ */
+uint32_t rcc_get_sysclk_hz(void) {
+    uint32_t sws = (RCC->CFGR >> RCC_CFGR_SWS_POS) & 0x3;
+
+    if (sws == RCC_CFGR_SW_HSI) return HSI_VALUE;
+    if (sws == RCC_CFGR_SW_HSE) return rcc_hse_hz;
+
+    uint32_t pllcfgr = RCC->PLLCFGR;
+    uint32_t src = (pllcfgr & RCC_PLLCFGR_PLLSRC_HSE) ? rcc_hse_hz : HSI_VALUE;
+    uint32_t m = (pllcfgr >> RCC_PLLCFGR_PLLM_POS) & 0x3F;
+    uint32_t n = (pllcfgr >> RCC_PLLCFGR_PLLN_POS) & 0x1FF;
+    uint32_t vco = (src / m) * n;
+
+    if (sws == RCC_CFGR_SW_PLL) {
+        return vco / ((((pllcfgr >> RCC_PLLCFGR_PLLP_POS) & 0x3) + 1) * 2);
+    }
+    return vco / ((pllcfgr >> RCC_PLLCFGR_PLLR_POS) & 0x7);   // PLL_R
+}
+
+/**
+ * @brief Sets SystemCoreClock to the current HCLK.
+ */
+void rcc_update_system_core_clock(void) {
+    system_core_clock_update(rcc_get_sysclk_hz() >> rcc_ahb_shift((RCC->CFGR >> RCC_CFGR_HPRE_POS) & 0xF));
+}
+
+/**
+ * @brief Returns HCLK (kept in SystemCoreClock).
+ *
+ * @return uint32_t HCLK in Hz.
+ */
+uint32_t rcc_get_hclk_hz(void) {
+    return SystemCoreClock;
+}
+
+/**
+ * @brief Computes PCLK1 from HCLK and PPRE1.
+ *
+ * @return uint32_t PCLK1 in Hz.
+ */
+uint32_t rcc_get_pclk1_hz(void) {
+    return SystemCoreClock >> rcc_apb_shift((RCC->CFGR >> RCC_CFGR_PPRE1_POS) & 0x7);
+}
+
+/**
+ * @brief Computes PCLK2 from HCLK and PPRE2.
+ *
+ * @return uint32_t PCLK2 in Hz.
+ */
+uint32_t rcc_get_pclk2_hz(void) {
+    return SystemCoreClock >> rcc_apb_shift((RCC->CFGR >> RCC_CFGR_PPRE2_POS) & 0x7);
+}
+
+/**
+ * @brief Timer clock for a bus with APB prescaler code `ppre`.
+ *
+ * TIMPRE = 0: x1 if APB divider is 1, else x2. TIMPRE = 1: HCLK if the
+ * divider is 1, 2 or 4, else x4.
+ *
+ * @param ppre 3-bit PPRE field.
+ * @return uint32_t Timer clock in Hz.
+ */
+static uint32_t rcc_timclk(uint32_t ppre) {
+    uint8_t shift = rcc_apb_shift(ppre);
+    uint32_t pclk = SystemCoreClock >> shift;
+
+    if (RCC->DCKCFGR & RCC_DCKCFGR_TIMPRE) {
+        return (shift <= 2) ? SystemCoreClock : (pclk << 2);
+    }
+    return shift ? (pclk << 1) : pclk;
+}
+
+/**
+ * @brief Timer clock of APB1 timers.
+ *
+ * @return uint32_t Clock in Hz.
+ */
+uint32_t rcc_get_apb1_timclk_hz(void) {
+    return rcc_timclk((RCC->CFGR >> RCC_CFGR_PPRE1_POS) & 0x7);
+}
+
+/**
+ * @brief Timer clock of APB2 timers.
+ *
+ * @return uint32_t Clock in Hz.
+ */
+uint32_t rcc_get_apb2_timclk_hz(void) {
+    return rcc_timclk((RCC->CFGR >> RCC_CFGR_PPRE2_POS) & 0x7);
+}
+
+/**
+ * @brief Returns the clock a peripheral runs from.
+ *
+ * Timers get their bus timer clock (x2 when the APB bus is divided), other
+ * APB peripherals PCLK1/PCLK2, AHB peripherals HCLK.
+ *
+ * @param periph Peripheral base pointer.
+ * @return uint32_t Clock in Hz, or 0 if `periph` is unknown.
+ */
+uint32_t rcc_get_pclk(const volatile void *periph) {
+    const periph_desc_t *d = periph_lookup(periph);
+    if (!d) return 0;
+
+    switch (d->clk) {
+        case RCC_CLK_PCLK1:    return rcc_get_pclk1_hz();
+        case RCC_CLK_PCLK2:    return rcc_get_pclk2_hz();
+        case RCC_CLK_APB1_TIM: return rcc_get_apb1_timclk_hz();
+        case RCC_CLK_APB2_TIM: return rcc_get_apb2_timclk_hz();
+        default:               return rcc_get_hclk_hz();
+    }
+}
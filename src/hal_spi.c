@@ -5,11 +5,66 @@
  * Provides low-level routines for sending and receiving SPI data and setting up
  * SPI peripherals in master mode using direct register access. Built to match
  * STM32F411RE peripheral capabilities.
+ *
+ * Block transfers use one DMA stream per direction. The RX stream always runs
+ * (into a dummy byte for write-only transfers) so the receive buffer never
+ * overruns, and its transfer-complete interrupt marks the end of the transfer.
  */
 
 #include <stdint.h>
 #include "hal_spi.h"
 #include "hal_uart.h"
+#include "hal_dma.h"
+#include "hal_rcc.h"
+
+#define SPI_PORT_COUNT 4U
+
+/**
+ * @brief Per-port block transfer state.
+ */
+typedef struct {
+    volatile uint8_t busy;   /**< 1 while a DMA transfer is running */
+    spi_callback_t cb;       /**< Completion callback, or 0 */
+} spi_state_t;
+
+static spi_state_t spi_state[SPI_PORT_COUNT];
+
+/// Source frame for receive-only transfers, and sink for transmit-only ones (8- or 16-bit).
+static const uint16_t spi_dummy_tx = (SPI_DUMMY_BYTE << 8) | SPI_DUMMY_BYTE;
+static uint16_t spi_dummy_rx;
+
+static SPI_TypeDef *const spi_ports[SPI_PORT_COUNT] = { SPI1, SPI2, SPI3, SPI4 };
+
+/**
+ * @brief Maps an SPI base address to its index in the driver tables.
+ *
+ * The RX/TX DMA requests come from the same descriptor (`periph_lookup()`).
+ * SPI2 shares DMA1 streams 3/4 with the USART3/UART4 transmit rings, so
+ * those can't be used together.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @return int 0–3 for SPI1–SPI4, -1 if unknown.
+ */
+static int spi_index(SPI_TypeDef *spix) {
+    return periph_index(spix, PERIPH_KIND_SPI);
+}
+
+/**
+ * @brief RX stream transfer-complete callback: ends the block transfer.
+ *
+ * @param flags DMA flags that were pending.
+ * @param ctx Port index, cast to a pointer.
+ */
+static void spi_dma_done(uint32_t flags, void *ctx) {
+    int idx = (int)(intptr_t)ctx;
+    SPI_TypeDef *spix = spi_ports[idx];
+
+    (void)flags;
+    spix->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+    spi_state[idx].busy = 0;
+
+    if (spi_state[idx].cb) spi_state[idx].cb(spix);
+}
 
 /**
  * @brief Transmits a single byte over SPI and receives a byte in return.
@@ -36,6 +91,59 @@ uint8_t spi_transfer(SPI_TypeDef *spix, uint8_t data){
     return spix->DR;
 }
 
+/**
+ * @brief Transmits and receives a single 16-bit frame.
+ *
+ * @param spix Pointer to SPI peripheral configured for 16-bit frames.
+ * @param data Frame to transmit.
+ * @return uint16_t Frame received.
+ */
+uint16_t spi_transfer16(SPI_TypeDef *spix, uint16_t data){
+    while (!(spix->SR & SPI_SR_TXE));
+    spix->DR = data;
+
+    while (!(spix->SR & SPI_SR_RXNE));
+    return (uint16_t)spix->DR;
+}
+
+/**
+ * @brief Polled burst that keeps one frame queued behind the one shifting out.
+ *
+ * At most two frames are in flight (shift register + TX buffer), which is
+ * exactly what the single-entry RX buffer can absorb without overrun.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param tx Frames to send, or 0 for dummy frames.
+ * @param rx Buffer for received frames, or 0 to discard.
+ * @param count Number of frames.
+ */
+void spi_transfer_burst(SPI_TypeDef *spix, const void *tx, void *rx, uint32_t count){
+    int wide = (spix->CR1 & SPI_CR1_DFF) ? 1 : 0;
+    uint32_t sent = 0, recv = 0;
+
+    while (spix->SR & SPI_SR_RXNE) (void)spix->DR;  // drop stale data
+
+    while (recv < count) {
+        if (sent < count && (sent - recv) < 2 && (spix->SR & SPI_SR_TXE)) {
+            uint16_t out = spi_dummy_tx;
+            if (tx) out = wide ? ((const uint16_t *)tx)[sent] : ((const uint8_t *)tx)[sent];
+            spix->DR = out;
+            sent++;
+        }
+
+        if (spix->SR & SPI_SR_RXNE) {
+            uint16_t in = (uint16_t)spix->DR;
+            if (rx) {
+                if (wide) ((uint16_t *)rx)[recv] = in;
+                else      ((uint8_t *)rx)[recv] = (uint8_t)in;
+            }
+            recv++;
+        }
+    }
+
+    while (spix->SR & SPI_SR_BSY);
+}
+
 /**
  * @brief Initializes the SPI peripheral in master mode with default settings.
  *
@@ -49,10 +157,24 @@ uint8_t spi_transfer(SPI_TypeDef *spix, uint8_t data){
  *
  * @param spix Pointer to SPI peripheral to configure (e.g., `SPI1`, `SPI2`, etc.)
  *
+ * Also enables the DMA controller clock and routes the RX stream interrupt used
+ * by `spi_transfer_buf()`.
+ *
  * @note Make sure GPIO pins for SCK, MOSI, and MISO are configured in alternate function mode
  *       before calling this function.
  */
 void spi_init(SPI_TypeDef *spix) {
+    int idx = spi_index(spix);
+
+    if (idx >= 0) {
+        const periph_desc_t *desc = periph_lookup(spix);
+
+        rcc_enable_dma(desc->dma_rx.dma);
+        rcc_enable_dma(desc->dma_tx.dma);
+        dma_stream_attach(&desc->dma_rx, spi_dma_done, (void *)(intptr_t)idx);
+        spi_state[idx].busy = 0;
+    }
+
     spix->CR1 = 0;            /**< Clear previous configuration */
 
     spix->CR1 |= (1 << 2);    /**< MSTR = 1 → Master mode */
@@ -65,3 +187,119 @@ void spi_init(SPI_TypeDef *spix) {
 
     spix->CR1 |= (1 << 6);    /**< SPE = 1 → SPI peripheral enabled */
 }
+
+/**
+ * @brief Initializes an SPI master from a `spi_config_t`.
+ *
+ * The baud rate divider is 2^(BR+1); the loop walks from /2 upward and stops
+ * at the first SCK that is not faster than `cfg->max_hz`.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param cfg Configuration (mode, frame, bit order, max SCK).
+ * @return uint32_t Resulting SCK frequency in Hz.
+ */
+uint32_t spi_init_config(SPI_TypeDef *spix, const spi_config_t *cfg) {
+    uint32_t pclk = rcc_get_pclk(spix);
+    uint32_t br = 0;
+
+    while (br < 7 && (pclk >> (br + 1)) > cfg->max_hz) br++;
+
+    spi_init(spix);                                      /**< DMA hookup, SSM/SSI, master */
+    spix->CR1 &= ~SPI_CR1_SPE;                           /**< CR1 fields change only while disabled */
+
+    uint32_t cr1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI;
+    cr1 |= (br << SPI_CR1_BR_POS);
+    cr1 |= ((uint32_t)cfg->mode & 0x3);                  /**< CPOL:CPHA */
+    if (cfg->frame == SPI_FRAME_16BIT)   cr1 |= SPI_CR1_DFF;
+    if (cfg->bit_order == SPI_LSB_FIRST) cr1 |= SPI_CR1_LSBFIRST;
+
+    spix->CR1 = cr1;
+    spix->CR1 |= SPI_CR1_SPE;
+
+    return pclk >> (br + 1);
+}
+
+/**
+ * @brief Starts a DMA block transfer on both directions.
+ *
+ * Order follows RM0390: RX stream first, then TX stream, then the SPI DMA
+ * requests, so no received byte can be missed.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param tx Frames to send, or 0 for dummy frames.
+ * @param rx Receive buffer, or 0 to discard.
+ * @param len Number of frames.
+ * @param cb Completion callback, or 0.
+ * @return int 0 if started, -1 if busy or invalid.
+ */
+int spi_transfer_buf(SPI_TypeDef *spix, const void *tx, void *rx,
+                     uint16_t len, spi_callback_t cb) {
+    int idx = spi_index(spix);
+    if (idx < 0 || len == 0 || spi_state[idx].busy) return -1;
+
+    const periph_desc_t *desc = periph_lookup(spix);
+    const dma_request_t *rx_req = &desc->dma_rx;
+    const dma_request_t *tx_req = &desc->dma_tx;
+    uint32_t base = (spix->CR1 & SPI_CR1_DFF)
+                  ? (DMA_SxCR_PSIZE_16 | DMA_SxCR_MSIZE_16 | DMA_SxCR_PL_HIGH)
+                  : (DMA_SxCR_PSIZE_8  | DMA_SxCR_MSIZE_8  | DMA_SxCR_PL_HIGH);
+
+    spi_state[idx].busy = 1;
+    spi_state[idx].cb = cb;
+
+    // Drop any stale byte (and OVR) left by earlier polled transfers
+    while (spix->SR & SPI_SR_RXNE) (void)spix->DR;
+    (void)spix->SR;
+
+    dma_stream_start(rx_req,
+                     base | DMA_SxCR_DIR_P2M | DMA_SxCR_TCIE | DMA_SxCR_TEIE |
+                     (rx ? DMA_SxCR_MINC : 0),
+                     &spix->DR, rx ? rx : (void *)&spi_dummy_rx, len);
+
+    dma_stream_start(tx_req,
+                     base | DMA_SxCR_DIR_M2P | (tx ? DMA_SxCR_MINC : 0),
+                     &spix->DR, tx ? tx : (const void *)&spi_dummy_tx, len);
+
+    spix->CR2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+
+    return 0;
+}
+
+/**
+ * @brief Transmit-only DMA block transfer.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param tx Frames to send.
+ * @param len Number of frames.
+ * @param cb Completion callback, or 0.
+ * @return int 0 if started, -1 if busy or invalid.
+ */
+int spi_write_buf(SPI_TypeDef *spix, const void *tx, uint16_t len, spi_callback_t cb) {
+    return spi_transfer_buf(spix, tx, 0, len, cb);
+}
+
+/**
+ * @brief Receive-only DMA block transfer.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @param rx Receive buffer.
+ * @param len Number of frames.
+ * @param cb Completion callback, or 0.
+ * @return int 0 if started, -1 if busy or invalid.
+ */
+int spi_read_buf(SPI_TypeDef *spix, void *rx, uint16_t len, spi_callback_t cb) {
+    return spi_transfer_buf(spix, 0, rx, len, cb);
+}
+
+/**
+ * @brief Reports whether a DMA block transfer is running.
+ *
+ * @param spix Pointer to SPI peripheral.
+ * @return int 1 if busy, 0 if idle.
+ */
+int spi_busy(SPI_TypeDef *spix) {
+    int idx = spi_index(spix);
+    if (idx < 0) return 0;
+
+    return spi_state[idx].busy;
+}
@@ -2,76 +2,196 @@
  * @file hal_systick.c
  * @brief SysTick timer implementation for STM32F411RE.
  *
- * This file implements initialization and delay routines using the Cortex-M4 SysTick timer.
- * Designed for simple blocking delays in microseconds or milliseconds. Suitable for
- * low-frequency, low-complexity tasks or startup-time code in bare-metal applications.
+ * This file implements the system time base on the Cortex-M4 SysTick timer: a
+ * 1 kHz interrupt counting a 64-bit tick, microsecond timestamps derived from
+ * the tick and the current counter value, non-blocking deadlines, and blocking
+ * delays that run on the same tick without reprogramming the timer.
  */
 
 #include <stdint.h>
 #include "hal_systick.h"
+#include "hal_nvic.h"
 
-/// @brief Default core clock frequency in Hz (used for delay calculations).
-uint32_t SystemCoreClock = 72000000U;
+/// @brief Current HCLK in Hz (used for delay calculations). Reset value: HSI, 16 MHz.
+uint32_t SystemCoreClock = 16000000U;
+
+/// Number of SysTick interrupts since the tick was started.
+static volatile uint64_t systick_ticks;
+
+/**
+ * @brief SysTick exception handler: advances the tick count.
+ */
+void SysTick_Handler(void) {
+    systick_ticks++;
+}
 
 /**
  * @brief Initializes the SysTick timer with a given tick interval.
  *
- * Sets the SysTick LOAD and VAL registers, and enables the counter using the processor clock.
+ * Sets the SysTick LOAD and VAL registers, and enables the counter using the
+ * processor clock with the tick interrupt.
  *
  * @param ticks Number of core clock cycles between rollovers.
- *
- * @note This does not set up interrupts. The timer is just running passively unless used manually.
  */
 void systick_init(uint32_t ticks){
     SysTick->LOAD = ticks - 1;
     SysTick->VAL = 0;
-    SysTick->CTRL = 0x05; // Enable SysTick with processor clock, no interrupt
+    SysTick->CTRL = CTRL_CLKSOURCE | CTRL_TICKINT | CTRL_ENABLE;
+}
+
+/**
+ * @brief Starts the 1 kHz tick at the lowest exception priority.
+ */
+void hal_tick_init(void) {
+    nvic_set_priority(SysTick_IRQn, (1U << NVIC_PRIO_BITS) - 1U);
+    systick_init(SystemCoreClock / HAL_TICK_HZ);
+}
+
+/**
+ * @brief Reads the 64-bit tick count atomically.
+ *
+ * @return uint64_t Tick count.
+ */
+uint64_t hal_ticks(void) {
+    uint32_t primask = irq_save();
+    uint64_t t = systick_ticks;
+    irq_restore(primask);
+    return t;
 }
 
 /**
- * @brief Blocks for a specified number of milliseconds using SysTick.
+ * @brief Returns the low 32 bits of the millisecond tick.
+ *
+ * @return uint32_t Milliseconds.
+ */
+uint32_t hal_millis(void) {
+    return (uint32_t)systick_ticks;   // single 32-bit load, no lock needed
+}
+
+/**
+ * @brief Tick count scaled to microseconds plus the elapsed part of the current tick.
+ *
+ * With interrupts masked the tick can't advance between the two reads. If the
+ * counter has reloaded but the exception is still pending, VAL is read again
+ * (now certainly after the reload) and the missing tick is added.
+ *
+ * @return uint64_t Microseconds.
+ */
+uint64_t hal_micros(void) {
+    uint32_t primask = irq_save();
+    uint64_t t = systick_ticks;
+    uint32_t val = SysTick->VAL;
+
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET) {
+        val = SysTick->VAL;
+        t++;
+    }
+    irq_restore(primask);
+
+    uint32_t load = SysTick->LOAD;
+    return t * (1000000U / HAL_TICK_HZ) + ((load - val) * (1000000U / HAL_TICK_HZ)) / (load + 1U);
+}
+
+/**
+ * @brief Busy-waits by accumulating SysTick counter decrements.
+ *
+ * Delays of 1 ms or more wait on `hal_micros()` instead, which avoids
+ * overflowing the cycle count.
  *
- * Configures SysTick for 1ms tick rate and blocks the CPU until the full delay is complete.
- * After the delay, SysTick is disabled to save power.
+ * @param us Number of microseconds to delay.
+ */
+void delay_us(uint32_t us){
+    if ((SysTick->CTRL & CTRL_ENABLE) == 0) hal_tick_init();
+
+    if (us >= 1000U) {
+        uint64_t end = hal_micros() + us;
+        while (hal_micros() < end);
+        return;
+    }
+
+    uint32_t target = us * (SystemCoreClock / 1000000U);
+    uint32_t reload = SysTick->LOAD + 1U;
+    uint32_t last = SysTick->VAL;
+    uint32_t elapsed = 0;
+
+    while (elapsed < target) {
+        uint32_t now = SysTick->VAL;
+        elapsed += (last >= now) ? (last - now) : (last + reload - now);   // down-counter, may reload
+        last = now;
+    }
+}
+
+/**
+ * @brief Blocks for a specified number of milliseconds on the running tick.
  *
  * @param ms Number of milliseconds to delay.
  */
 void delay_ms(uint32_t ms)
 {
-    SysTick->LOAD = (SystemCoreClock / 1000U) - 1;
-    SysTick->VAL = 0;
-    SysTick->CTRL = CTRL_CLKSOURCE | CTRL_ENABLE;
+    if ((SysTick->CTRL & CTRL_ENABLE) == 0) hal_tick_init();
 
-    for (uint32_t i = 0; i < ms; i++) {
-        while ((SysTick->CTRL & CTRL_COUNTFLAG) == 0);
-    }
+    uint64_t end = hal_micros() + (uint64_t)ms * 1000U;
+    while (hal_micros() < end);
+}
 
-    SysTick->CTRL = 0; // Disable after delay
+/**
+ * @brief Sets the expiry to now + `timeout_us`.
+ *
+ * @param d Deadline.
+ * @param timeout_us Timeout in microseconds.
+ */
+void hal_deadline_set_us(hal_deadline_t *d, uint32_t timeout_us) {
+    d->expires_us = hal_micros() + timeout_us;
 }
 
 /**
- * @brief Blocks for a specified number of microseconds using SysTick.
+ * @brief Sets the expiry to now + `timeout_ms`.
  *
- * Uses a single-shot delay by measuring elapsed ticks from the SysTick value register.
+ * @param d Deadline.
+ * @param timeout_ms Timeout in milliseconds.
+ */
+void hal_deadline_set_ms(hal_deadline_t *d, uint32_t timeout_ms) {
+    d->expires_us = hal_micros() + (uint64_t)timeout_ms * 1000U;
+}
+
+/**
+ * @brief Compares the expiry with the current time.
  *
- * @param us Number of microseconds to delay.
+ * @param d Deadline.
+ * @return int 1 if expired.
+ */
+int hal_deadline_expired(const hal_deadline_t *d) {
+    return (hal_micros() >= d->expires_us) ? 1 : 0;
+}
+
+/**
+ * @brief Computes the time left before expiry.
  *
- * @note Assumes `SystemCoreClock` is valid and SYSTICK_LOAD is set appropriately.
+ * @param d Deadline.
+ * @return uint32_t Remaining microseconds, saturated to 32 bits.
  */
-void delay_us(uint32_t us){
-    uint32_t ticks = (us * SYSTICK_LOAD) - SYSTICK_DELAY_CALIB;
-    uint32_t start = SysTick->VAL;
-    while ((start - SysTick->VAL) < ticks);
+uint32_t hal_deadline_remaining_us(const hal_deadline_t *d) {
+    uint64_t now = hal_micros();
+
+    if (now >= d->expires_us) return 0;
+    if (d->expires_us - now > 0xFFFFFFFFU) return 0xFFFFFFFFU;
+    return (uint32_t)(d->expires_us - now);
 }
 
 /**
  * @brief Updates the global SystemCoreClock variable.
  *
  * Used to keep delay calculations accurate after PLL or clock source changes.
- * This does not change the hardware clock — it only updates software logic.
+ * This does not change the hardware clock — it only updates software logic,
+ * plus the tick reload value when the tick is running.
  *
  * @param new_freq New core clock frequency in Hz.
  */
 void system_core_clock_update(uint32_t new_freq){
     SystemCoreClock = new_freq;
+
+    if (SysTick->CTRL & CTRL_ENABLE) {
+        SysTick->LOAD = new_freq / HAL_TICK_HZ - 1U;
+        SysTick->VAL = 0;
+    }
 }
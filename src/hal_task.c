@@ -0,0 +1,175 @@
+/**
+ * @file hal_task.c
+ * @brief Fixed-rate periodic task dispatcher implementation (TIM6/TIM7).
+ *
+ * Each group is driven by one basic timer's update interrupt through
+ * `tim_set_update_callback()`. The handler records the entry latency from
+ * CNT, runs the tasks whose countdown expired with DWT timing around each,
+ * and finally checks UIF to detect a tick that arrived while it was busy.
+ */
+
+#include <stdint.h>
+#include "hal_task.h"
+#include "hal_tim.h"
+#include "hal_rcc.h"
+#include "hal_nvic.h"
+#include "hal_bitband.h"
+#include "stm32f4_dwt.h"
+
+/// Group statistics: fast (TIM6), slow (TIM7).
+static hal_task_group_t task_groups[2];
+
+/// Timer of each group.
+static TIM_TypeDef *const task_timers[2] = { TIM6, TIM7 };
+
+/// Task table handed to hal_task_start().
+static hal_task_t *task_table;
+static uint8_t task_count;
+
+/**
+ * @brief Clears the statistics of one task.
+ *
+ * @param t Task.
+ */
+static void hal_task_clear(hal_task_t *t) {
+    t->runs = 0;
+    t->overruns = 0;
+    t->exec_last = 0;
+    t->exec_min = 0xFFFFFFFFU;
+    t->exec_max = 0;
+    t->exec_total = 0;
+}
+
+/**
+ * @brief Serves one tick of a group (update interrupt callback).
+ *
+ * @param timx Group timer.
+ * @param ctx Group statistics.
+ */
+static void hal_task_tick(TIM_TypeDef *timx, void *ctx) {
+    hal_task_group_t *g = (hal_task_group_t *)ctx;
+    uint8_t group = (uint8_t)(g - task_groups);
+    uint32_t latency = timx->CNT;
+
+    if (latency < g->latency_min) g->latency_min = latency;
+    if (latency > g->latency_max) g->latency_max = latency;
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        hal_task_t *t = &task_table[i];
+        uint32_t t0, dt;
+
+        if (t->group != group || --t->countdown) continue;
+        t->countdown = t->divider;
+
+        t0 = DWT->CYCCNT;
+        t->fn(t->ctx);
+        dt = DWT->CYCCNT - t0;
+
+        t->exec_last = dt;
+        t->exec_total += dt;
+        if (dt < t->exec_min) t->exec_min = dt;
+        if (dt > t->exec_max) t->exec_max = dt;
+        if (dt > t->period_cycles) t->overruns++;
+        t->runs++;
+    }
+
+    g->ticks++;
+    if (timx->SR & TIM_SR_UIF) g->overruns++;                // next tick already due
+}
+
+/**
+ * @brief Assigns groups, solves the timer rates and starts both timers.
+ *
+ * @param tasks Task table.
+ * @param count Number of tasks.
+ * @return int 0 on success, -1 on an unschedulable table.
+ */
+int hal_task_start(hal_task_t *tasks, uint8_t count) {
+    uint32_t fast = 0, slow = 0;
+    uint32_t hclk = rcc_get_hclk_hz();
+
+    if (count == 0) return -1;
+    hal_task_stop();
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (!tasks[i].fn || tasks[i].rate_hz == 0) return -1;
+        if (tasks[i].rate_hz > fast) fast = tasks[i].rate_hz;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (tasks[i].rate_hz != fast && tasks[i].rate_hz > slow) slow = tasks[i].rate_hz;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        hal_task_t *t = &tasks[i];
+        uint32_t base = (t->rate_hz == fast) ? fast : slow;
+
+        if (base % t->rate_hz) return -1;
+        t->group = (t->rate_hz == fast) ? 0 : 1;
+        t->divider = base / t->rate_hz;
+        t->countdown = t->divider;
+        t->period_cycles = hclk / t->rate_hz;
+    }
+
+    task_groups[0].rate_hz = fast;
+    task_groups[1].rate_hz = slow;
+    for (uint8_t g = 0; g < 2; g++) {
+        if (task_groups[g].rate_hz && tim_set_rate(task_timers[g], task_groups[g].rate_hz) != 0) return -1;
+    }
+
+    task_table = tasks;
+    task_count = count;
+    hal_task_reset_stats();
+
+    DEMCR |= DEMCR_TRCENA;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+
+    tim_set_update_callback(TIM6, hal_task_tick, &task_groups[0], HAL_TASK_FAST_PRIORITY);
+    if (slow) tim_set_update_callback(TIM7, hal_task_tick, &task_groups[1], HAL_TASK_SLOW_PRIORITY);
+
+    BITBAND_PERIPH(&TIM6->CR1, TIM_CR1_CEN_POS) = 1;
+    if (slow) BITBAND_PERIPH(&TIM7->CR1, TIM_CR1_CEN_POS) = 1;
+    return 0;
+}
+
+/**
+ * @brief Stops the dispatcher.
+ */
+void hal_task_stop(void) {
+    for (uint8_t g = 0; g < 2; g++) {
+        if (!task_groups[g].rate_hz) continue;
+        BITBAND_PERIPH(&task_timers[g]->CR1, TIM_CR1_CEN_POS) = 0;
+        tim_set_update_callback(task_timers[g], 0, 0, 0);
+        task_groups[g].rate_hz = 0;
+    }
+    task_count = 0;
+}
+
+/**
+ * @brief Returns a group's statistics.
+ *
+ * @param group Group index.
+ * @return const hal_task_group_t* Statistics, or 0.
+ */
+const hal_task_group_t *hal_task_group_stats(uint8_t group) {
+    return (group < 2) ? &task_groups[group] : 0;
+}
+
+/**
+ * @brief Clears all statistics.
+ *
+ * Runs with interrupts masked so a tick can't update half-cleared values.
+ */
+void hal_task_reset_stats(void) {
+    uint32_t primask = irq_save();
+
+    for (uint8_t i = 0; i < task_count; i++) hal_task_clear(&task_table[i]);
+    for (uint8_t g = 0; g < 2; g++) {
+        task_groups[g].tick_hz = task_groups[g].rate_hz ? (task_timers[g]->ARR + 1U) * task_groups[g].rate_hz : 0;
+        task_groups[g].ticks = 0;
+        task_groups[g].overruns = 0;
+        task_groups[g].latency_min = 0xFFFFFFFFU;
+        task_groups[g].latency_max = 0;
+    }
+
+    irq_restore(primask);
+}
@@ -5,6 +5,7 @@
  * This file provides simple timer functions for:
  * - Generating basic delays (1 Hz overflow)
  * - Setting up PWM output (for motors, LEDs, etc.)
+ * - Input capture and PWM-input measurement, optionally logged by DMA
  *
  * This is part of a custom STM32F4 HAL written from scratch with no STM HAL or CMSIS.
  * All register access is direct and uses only official STM32 documentation.
@@ -15,12 +16,200 @@
 #include <stdint.h>
 #include "hal_tim.h"
 #include "hal_rcc.h"
+#include "hal_bitband.h"
+#include "hal_dma.h"
+#include "hal_nvic.h"
+#include "hal_systick.h"
+
+/// Rows of the per-timer tables: TIM1–TIM5, TIM8, then the basic timers TIM6, TIM7.
+#define TIM_ROWS     8
+/// Leading rows that have capture/compare channels and DMA requests.
+#define TIM_CC_ROWS  6
+
+/**
+ * @brief TIMx_CHy DMA request mapping (RM0390 DMA1/DMA2 request tables).
+ *
+ * Rows: TIM1, TIM2, TIM3, TIM4, TIM5, TIM8; columns: CH1–CH4. A null
+ * controller means the channel has no DMA request.
+ */
+static const dma_request_t tim_cc_dma[TIM_CC_ROWS][4] = {
+    { { DMA2, 1, 6 }, { DMA2, 2, 6 }, { DMA2, 6, 6 }, { DMA2, 4, 6 } },   // TIM1
+    { { DMA1, 5, 3 }, { DMA1, 6, 3 }, { DMA1, 1, 3 }, { DMA1, 7, 3 } },   // TIM2
+    { { DMA1, 4, 5 }, { DMA1, 5, 5 }, { DMA1, 7, 5 }, { DMA1, 2, 5 } },   // TIM3
+    { { DMA1, 0, 2 }, { DMA1, 3, 2 }, { DMA1, 7, 2 }, { 0, 0, 0 } },      // TIM4
+    { { DMA1, 2, 6 }, { DMA1, 4, 6 }, { DMA1, 0, 6 }, { DMA1, 1, 6 } },   // TIM5
+    { { DMA2, 2, 7 }, { DMA2, 3, 7 }, { DMA2, 4, 7 }, { DMA2, 7, 7 } },   // TIM8
+};
+
+/**
+ * @brief Burst playback state of one timer.
+ */
+typedef struct {
+    TIM_TypeDef *timx;           /**< Timer */
+    tim_burst_callback_t cb;     /**< Refill/done callback, or 0 */
+    void *ctx;                   /**< User pointer */
+    tim_burst_mode_t mode;       /**< Playback mode */
+} tim_burst_state_t;
+
+/// Burst playback state, same rows as `tim_cc_dma`.
+static tim_burst_state_t tim_burst[TIM_CC_ROWS];
+
+/**
+ * @brief Quadrature encoder state of one timer.
+ */
+typedef struct {
+    volatile int32_t high;      /**< Counts carried out of the 16-bit counter (multiples of 65536) */
+    int32_t last_pos;           /**< Position at the previous velocity call */
+    uint64_t last_us;           /**< Time of the previous velocity call, 0 = none yet */
+    uint8_t active;             /**< 1 while the timer runs in encoder mode */
+} tim_encoder_state_t;
+
+/// Encoder state, same rows as `tim_cc_dma`.
+static tim_encoder_state_t tim_encoder[TIM_CC_ROWS];
+
+/**
+ * @brief Update callback registered for one timer.
+ */
+typedef struct {
+    tim_callback_t cb;           /**< Callback, or 0 */
+    void *ctx;                   /**< User pointer */
+} tim_update_slot_t;
+
+/// Update callbacks, by row.
+static tim_update_slot_t tim_update[TIM_ROWS];
+
+/// Timers of the per-timer tables, by row.
+static TIM_TypeDef *const tim_ports[TIM_ROWS] = { TIM1, TIM2, TIM3, TIM4, TIM5, TIM8, TIM6, TIM7 };
+
+/**
+ * @brief Maps a timer to its row in the per-timer tables (`tim_cc_dma`, ...).
+ *
+ * The row is the descriptor's `unit`; the update interrupt line and the
+ * TIMx_UP DMA request (`dma_tx`) come from the same descriptor.
+ *
+ * @param timx Timer instance.
+ * @return int 0–5 for TIM1–TIM5/TIM8 (rows with capture/compare DMA),
+ *         6–7 for TIM6/TIM7, or -1 for other timers.
+ */
+static int tim_index(TIM_TypeDef *timx) {
+    int idx = periph_index(timx, PERIPH_KIND_TIM);
+    return (idx < TIM_ROWS) ? idx : -1;
+}
+
+/**
+ * @brief Returns the CCMR register holding a channel's mode byte.
+ *
+ * @param timx Timer instance.
+ * @param channel Channel 1–4.
+ * @return volatile uint32_t* CCMR1 (CH1/CH2) or CCMR2 (CH3/CH4).
+ */
+static volatile uint32_t *tim_ccmr(TIM_TypeDef *timx, uint8_t channel) {
+    return (channel <= 2) ? &timx->CCMR1 : &timx->CCMR2;
+}
+
+/**
+ * @brief Programs a channel's CCMR byte as input and its CCER polarity, then enables capture.
+ *
+ * @param timx Timer instance.
+ * @param channel Channel 1–4.
+ * @param ccs `TIM_CCMR_CCS_DIRECT` or `TIM_CCMR_CCS_INDIRECT`.
+ * @param edge Capture edge(s).
+ * @param psc ICxPSC code 0–3.
+ * @param filter ICxF code 0–15.
+ */
+static void tim_ic_setup(TIM_TypeDef *timx, uint8_t channel, uint32_t ccs,
+                         tim_ic_edge_t edge, uint8_t psc, uint8_t filter) {
+    volatile uint32_t *ccmr = tim_ccmr(timx, channel);
+    uint32_t byte_shift = ((channel - 1U) & 1U) * 8U;
+    uint32_t ccer_shift = (channel - 1U) * 4U;
+
+    timx->CCER &= ~((TIM_CCER_CC1E | TIM_CCER_CC1P | TIM_CCER_CC1NP) << ccer_shift);   // CCxS is writable only with CCxE = 0
+
+    *ccmr = (*ccmr & ~(0xFFU << byte_shift)) |
+            ((ccs | ((uint32_t)(psc & 0x3U) << TIM_CCMR_ICPSC_POS) |
+              ((uint32_t)(filter & 0xFU) << TIM_CCMR_ICF_POS)) << byte_shift);
+
+    timx->CCER |= ((uint32_t)edge | TIM_CCER_CC1E) << ccer_shift;
+}
+
+/**
+ * @brief Returns the kernel clock of a timer.
+ *
+ * @param timx Timer instance.
+ * @return uint32_t APB2 timer clock for TIM1/8/9/10/11, APB1 timer clock otherwise.
+ */
+static uint32_t tim_clock_hz(TIM_TypeDef *timx) {
+    return rcc_get_pclk(timx);
+}
+
+/**
+ * @brief Timer is 32 bits wide (TIM2, TIM5).
+ *
+ * @param timx Timer instance.
+ * @return int 1 for 32-bit counters.
+ */
+static int tim_is_32bit(TIM_TypeDef *timx) {
+    return timx == TIM2 || timx == TIM5;
+}
+
+/**
+ * @brief Returns the tick rate of a timer's counter.
+ *
+ * @param timx Timer instance.
+ * @return uint32_t Timer kernel clock divided by (PSC + 1).
+ */
+static uint32_t tim_tick_hz(TIM_TypeDef *timx) {
+    return tim_clock_hz(timx) / (timx->PSC + 1U);
+}
+
+/**
+ * @brief Find PSC/ARR for an update rate.
+ *
+ * The division N = clk / rate is split as (PSC + 1) × (ARR + 1) with the
+ * smallest prescaler that divides N exactly and leaves ARR + 1 within
+ * `max_arr + 1`, so the rate is exact and the counter resolution maximal.
+ * If no exact split exists (N prime and too large, or clk not a multiple of
+ * rate) the nearest N is split instead.
+ *
+ * @param clk_hz Timer kernel clock.
+ * @param rate_hz Wanted update rate.
+ * @param max_arr Largest ARR value (0xFFFF or 0xFFFFFFFF).
+ * @param psc PSC register value (prescaler - 1).
+ * @param arr ARR register value (period - 1).
+ * @return int 0 if exact, 1 if approximate, -1 if out of range.
+ */
+static int tim_solve_rate(uint32_t clk_hz, uint32_t rate_hz, uint32_t max_arr,
+                          uint32_t *psc, uint32_t *arr) {
+    uint32_t n, d, d_min;
+    int exact;
+
+    if (rate_hz == 0 || rate_hz > clk_hz) return -1;
+    n = (clk_hz + rate_hz / 2U) / rate_hz;
+    exact = (clk_hz % rate_hz) == 0;
+
+    d_min = (max_arr == 0xFFFFFFFFUL) ? 1U : (n + max_arr) / (max_arr + 1U);   // ceil(n / 65536)
+    if (d_min == 0) d_min = 1;
+    if (d_min > 0x10000U) return -1;
+
+    for (d = d_min; d <= 0x10000U; d++) {
+        if (n % d == 0) break;
+    }
+    if (d > 0x10000U || n / d > (uint64_t)max_arr + 1U) {            // no exact split: round
+        d = d_min;
+        n = d * ((n + d / 2U) / d);
+        exact = 0;
+    }
+
+    *psc = d - 1U;
+    *arr = n / d - 1U;
+    return exact ? 0 : 1;
+}
 
 /**
  * @brief Initialize a timer to overflow every 1 second (1Hz).
  *
- * This sets up a basic timer using a fixed prescaler and a computed auto-reload value.
- * When started, the timer will count up and overflow once every second.
+ * Solves the prescaler and auto-reload value for the given clock, so the
+ * period is exact for any timer clock that is a whole number of Hz.
  *
  * Useful for:
  * - Blinking an LED
@@ -31,15 +220,62 @@
  * @param clk_hz The clock frequency driving the timer (in Hz).
  *
  * @note This function starts the timer immediately in upcounting mode.
- * @warning Assumes a hardcoded prescaler of 1600.
  */
 void tim_1hz_init(TIM_TypeDef *timx, uint32_t clk_hz) {
+    uint32_t psc, arr;
+
     rcc_enable_tim(timx);
 
-    timx->PSC = 1600 - 1;                            // Divide timer clock by 1600
-    timx->ARR = clk_hz / (timx->PSC + 1);            // Set auto-reload value for 1 Hz
+    if (tim_solve_rate(clk_hz, 1, 0xFFFFU, &psc, &arr) < 0) return;
+    timx->PSC = psc;                                 // Prescaler for 1 Hz
+    timx->ARR = arr;                                 // Period for 1 Hz
+    timx->EGR = TIM_EGR_UG;                          // Load PSC now
     timx->CNT = 0;                                   // Reset timer counter
-    timx->CR1 |= TIM_CR1_CEN;                        // Start the timer
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_CEN_POS) = 1;   // Start the timer
+}
+
+/**
+ * @brief Set a timer's update rate from its real kernel clock.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param rate_hz Update events per second.
+ * @return int 0 if exact, 1 if approximate, -1 if unreachable.
+ */
+int tim_set_rate(TIM_TypeDef *timx, uint32_t rate_hz) {
+    uint32_t psc, arr;
+    int rc;
+
+    rcc_enable_tim(timx);
+
+    rc = tim_solve_rate(tim_clock_hz(timx), rate_hz, tim_is_32bit(timx) ? 0xFFFFFFFFUL : 0xFFFFU, &psc, &arr);
+    if (rc < 0) return -1;
+
+    timx->PSC = psc;
+    timx->ARR = arr;
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_URS_POS) = 1;   // UG below raises no interrupt
+    timx->EGR = TIM_EGR_UG;
+    return rc;
+}
+
+/**
+ * @brief Run a timer as a trigger source (TRGO = update).
+ *
+ * MMS is set after tim_set_rate()'s UG, so that reload emits no trigger.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param rate_hz Trigger events per second.
+ * @return int 0 if exact, 1 if approximate, -1 if unreachable.
+ */
+int tim_set_trgo_rate(TIM_TypeDef *timx, uint32_t rate_hz) {
+    int rc;
+
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_CEN_POS) = 0;   // CEN off while reprogramming
+    rc = tim_set_rate(timx, rate_hz);
+    if (rc < 0) return -1;
+
+    timx->CR2 = (timx->CR2 & ~TIM_CR2_MMS_MSK) | TIM_CR2_MMS_UPDATE;
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_CEN_POS) = 1;
+    return rc;
 }
 
 /**
@@ -54,27 +290,33 @@ void tim_1hz_init(TIM_TypeDef *timx, uint32_t clk_hz) {
  * - Generating analog-like voltages via filtering
  *
  * @param timx Pointer to the TIMx peripheral (e.g., TIM2, TIM3).
- * @param prescaler Timer prescaler (raw value, not PSC - 1).
- *        Example: A value of 1600 divides the timer clock by 1600.
+ * @param tick_hz Counter frequency in Hz (0 = timer clock undivided).
+ *        Example: 10000 on a 90 MHz timer clock gives PSC = 8999.
  * @param arr Auto-reload value — this sets the PWM period (raw).
  *        Example: An ARR of 100 creates a 0–99 count range.
  *
  * @note This function does NOT start the timer. Call @ref tim_pwm_start() to begin output.
  */
-void tim_pwm_init(TIM_TypeDef *timx, uint16_t prescaler, uint16_t arr) {
+void tim_pwm_init(TIM_TypeDef *timx, uint32_t tick_hz, uint16_t arr) {
+    uint32_t div = 1;
+
     rcc_enable_tim(timx);
 
-    timx->PSC = prescaler - 1;          // Set prescaler
+    if (tick_hz) div = (tim_clock_hz(timx) + tick_hz / 2U) / tick_hz;
+    if (div == 0) div = 1;
+    if (div > 0x10000UL) div = 0x10000UL;
+
+    timx->PSC = div - 1;                // Set prescaler
     timx->ARR = arr - 1;                // Set auto-reload value
-    timx->CR1 |= TIM_CR1_ARPE;          // Enable auto-reload preload
-    timx->EGR |= TIM_EGR_UG;            // Apply changes immediately
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_ARPE_POS) = 1;
+    timx->EGR = TIM_EGR_UG;             // Apply changes immediately
 }
 
 /**
  * @brief Set up a specific PWM output channel on a timer.
  *
  * This configures a timer channel in PWM Mode 1, sets its duty cycle,
- * and enables output. It only supports Channel 1 for now.
+ * and enables output.
  *
  * PWM Mode 1:
  * - Output is HIGH while counter < duty
@@ -84,25 +326,99 @@ void tim_pwm_init(TIM_TypeDef *timx, uint16_t prescaler, uint16_t arr) {
  * @param channel PWM channel to configure (1–4).
  * @param duty Duty cycle in ticks (0 to ARR value).
  *        Example: If ARR=100 and duty=25, output will be high for 25% of the time.
- *
- * @note Currently, only channel 1 is implemented. You can extend this function to handle CH2–CH4.
  */
 void tim_pwm_config_channel(TIM_TypeDef *timx, uint8_t channel, uint16_t duty) {
-    switch (channel) {
-        case 1:
-            // Configure Channel 1 for PWM Mode 1
-            timx->CCMR1 &= ~(0x7 << 4);                              // Clear output mode bits
-            timx->CCMR1 |= TIM_CCMR1_OC1M_PWM1 | TIM_CCMR1_OC1PE;    // Set PWM1 mode, enable preload
-            timx->CCR1 = duty;                                       // Set duty cycle
-            timx->CCER |= TIM_CCER_CC1E;                             // Enable output on channel 1
-            break;
-
-        default:
-            // Not implemented
-            break;
-    }
+    (void)tim_pwm_config_output(timx, channel, TIM_PWM_MODE1, duty, 0);
+}
+
+/**
+ * @brief Set up a PWM channel with a given mode and optional CHxN output.
+ *
+ * Works on the channel's byte of CCMR1/CCMR2 and its nibble of CCER, so
+ * all four channels share one code path.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param channel PWM channel (1–4).
+ * @param mode PWM mode 1 or 2.
+ * @param duty Compare value in ticks.
+ * @param complementary 1 to enable CHxN (TIM1/TIM8, CH1–CH3).
+ * @return int 0 on success, -1 on invalid arguments.
+ */
+int tim_pwm_config_output(TIM_TypeDef *timx, uint8_t channel, tim_pwm_mode_t mode,
+                          uint32_t duty, uint8_t complementary) {
+    uint8_t advanced = (timx == TIM1 || timx == TIM8);
+    volatile uint32_t *ccmr;
+    uint32_t byte_shift, ccer_shift;
+
+    if (channel < 1 || channel > 4) return -1;
+    if (complementary && (!advanced || channel == 4)) return -1;
+
+    ccmr = tim_ccmr(timx, channel);
+    byte_shift = ((channel - 1U) & 1U) * 8U;
+    ccer_shift = (channel - 1U) * 4U;
+
+    timx->CCER &= ~(0xFU << ccer_shift);                                  // CCxS is writable only with CCxE = 0
+    *ccmr = (*ccmr & ~(0xFFU << byte_shift)) |
+            ((((uint32_t)mode << TIM_CCMR_OCM_POS) | TIM_CCMR1_OC1PE) << byte_shift);   // output, mode, preload
+    tim_pwm_set_duty(timx, channel, duty);
+    timx->CCER |= (TIM_CCER_CC1E | (complementary ? TIM_CCER_CC1NE : 0)) << ccer_shift;
 
-    timx->EGR |= TIM_EGR_UG;  // Apply preload register changes
+    if (advanced) BITBAND_PERIPH(&timx->BDTR, TIM_BDTR_MOE_POS) = 1;
+    timx->EGR = TIM_EGR_UG;   // Apply preload register changes
+    return 0;
+}
+
+/**
+ * @brief Select edge- or center-aligned counting (CR1.CMS).
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param mode Counter alignment.
+ */
+void tim_pwm_set_count_mode(TIM_TypeDef *timx, tim_count_mode_t mode) {
+    timx->CR1 = (timx->CR1 & ~TIM_CR1_CMS_MSK) | ((uint32_t)mode << TIM_CR1_CMS_POS);
+}
+
+/**
+ * @brief Encode a dead-time for BDTR.DTG.
+ *
+ * With CKD = 0 (t_DTS = timer clock period), DTG selects one of four ranges:
+ * 0xxxxxxx = n, 10xxxxxx = (64 + n) × 2, 110xxxxx = (32 + n) × 8,
+ * 111xxxxx = (32 + n) × 16 clock cycles.
+ *
+ * @param clk_hz Timer kernel clock.
+ * @param ns Requested dead-time (rounded up).
+ * @return int DTG code 0–255, or -1 if out of range.
+ */
+static int tim_deadtime_dtg(uint32_t clk_hz, uint32_t ns) {
+    uint32_t t = (uint32_t)(((uint64_t)ns * clk_hz + 999999999ULL) / 1000000000ULL);
+
+    if (t <= 127)  return (int)t;
+    if (t <= 254)  return (int)(0x80U | ((t + 1U) / 2U - 64U));
+    if (t <= 504)  return (int)(0xC0U | ((t + 7U) / 8U - 32U));
+    if (t <= 1008) return (int)(0xE0U | ((t + 15U) / 16U - 32U));
+    return -1;
+}
+
+/**
+ * @brief Program dead-time, break input and main output enable.
+ *
+ * @param timx TIM1 or TIM8.
+ * @param cfg Dead-time and break settings.
+ * @return int 0 on success, -1 on unsupported timer or dead-time.
+ */
+int tim_pwm_bdtr_config(TIM_TypeDef *timx, const tim_bdtr_config_t *cfg) {
+    int dtg;
+
+    if (timx != TIM1 && timx != TIM8) return -1;
+    dtg = tim_deadtime_dtg(tim_clock_hz(timx), cfg->deadtime_ns);
+    if (dtg < 0) return -1;
+
+    timx->BDTR = (uint32_t)dtg | TIM_BDTR_OSSR | TIM_BDTR_OSSI |
+                 (cfg->break_enable ? TIM_BDTR_BKE : 0) |
+                 (cfg->break_high   ? TIM_BDTR_BKP : 0) |
+                 (cfg->auto_restart ? TIM_BDTR_AOE : 0) |
+                 TIM_BDTR_MOE;
+    return 0;
 }
 
 /**
@@ -116,6 +432,513 @@ void tim_pwm_config_channel(TIM_TypeDef *timx, uint8_t channel, uint16_t duty) {
  * @note If PWM output is configured, the waveform will begin after this call.
  */
 void tim_pwm_start(TIM_TypeDef *timx) {
-    timx->EGR |= TIM_EGR_UG;        // Apply register preload values
-    timx->CR1 |= TIM_CR1_CEN;       // Enable timer counter
+    timx->EGR = TIM_EGR_UG;             // Apply register preload values
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_CEN_POS) = 1;
 }
+
+/**
+ * @brief Set up a timer as a free-running capture time base.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param prescaler Timer prescaler (raw value, not PSC - 1).
+ *
+ * @note Writing 0xFFFFFFFF to ARR of a 16-bit timer leaves 0xFFFF.
+ */
+void tim_ic_init(TIM_TypeDef *timx, uint16_t prescaler) {
+    rcc_enable_tim(timx);
+
+    timx->PSC = prescaler - 1;          // Set prescaler
+    timx->ARR = 0xFFFFFFFFUL;           // Full counter range
+    timx->EGR = TIM_EGR_UG;             // Load PSC now
+}
+
+/**
+ * @brief Configure an input capture channel on its own pin (CCxS = TIx).
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param cfg Channel configuration.
+ * @return int 0 on success, -1 on invalid channel.
+ */
+int tim_ic_config_channel(TIM_TypeDef *timx, const tim_ic_config_t *cfg) {
+    if (cfg->channel < 1 || cfg->channel > 4) return -1;
+
+    tim_ic_setup(timx, cfg->channel, TIM_CCMR_CCS_DIRECT, cfg->edge, cfg->prescaler, cfg->filter);
+    return 0;
+}
+
+/**
+ * @brief Configure PWM-input mode on CH1/CH2.
+ *
+ * The input channel captures the period edge on its own pin and resets the
+ * counter through the slave mode controller; the paired channel captures the
+ * opposite edge of the same pin (indirect mapping).
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param channel 1 (TI1) or 2 (TI2).
+ * @param edge Period edge, rising or falling.
+ * @param filter ICxF filter code.
+ * @return int 0 on success, -1 on invalid arguments.
+ */
+int tim_ic_pwm_input(TIM_TypeDef *timx, uint8_t channel, tim_ic_edge_t edge, uint8_t filter) {
+    tim_ic_edge_t other;
+    uint8_t pair;
+
+    if ((channel != 1 && channel != 2) || edge == TIM_IC_BOTH) return -1;
+    pair  = (channel == 1) ? 2 : 1;
+    other = (edge == TIM_IC_RISING) ? TIM_IC_FALLING : TIM_IC_RISING;
+
+    tim_ic_setup(timx, channel, TIM_CCMR_CCS_DIRECT, edge, 0, filter);
+    tim_ic_setup(timx, pair, TIM_CCMR_CCS_INDIRECT, other, 0, filter);
+
+    timx->SMCR = (timx->SMCR & ~(TIM_SMCR_TS_MSK | TIM_SMCR_SMS_MSK)) |
+                 ((channel == 1) ? TIM_SMCR_TS_TI1FP1 : TIM_SMCR_TS_TI2FP2) |
+                 TIM_SMCR_SMS_RESET;
+    return 0;
+}
+
+/**
+ * @brief Read the last capture of a channel.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param channel Channel 1–4.
+ * @return uint32_t CCRx value.
+ */
+uint32_t tim_ic_read(TIM_TypeDef *timx, uint8_t channel) {
+    return (&timx->CCR1)[(channel - 1U) & 0x3U];
+}
+
+/**
+ * @brief Start a circular capture log on a channel.
+ *
+ * The stream moves one 32-bit word per capture event from CCRx to the
+ * buffer and wraps forever; no stream interrupt is enabled.
+ *
+ * @param cap Stream object.
+ * @param timx Pointer to the TIMx peripheral.
+ * @param channel Channel 1–4.
+ * @param buf Sample buffer.
+ * @param len Buffer length in samples.
+ * @return int 0 if started, -1 if unsupported.
+ */
+int tim_ic_dma_start(tim_ic_dma_t *cap, TIM_TypeDef *timx, uint8_t channel,
+                     uint32_t *buf, uint16_t len) {
+    int idx = tim_index(timx);
+    const dma_request_t *req;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS || channel < 1 || channel > 4 || len < 2) return -1;
+    req = &tim_cc_dma[idx][channel - 1];
+    if (!req->dma) return -1;
+
+    cap->timx = timx;
+    cap->req = req;
+    cap->buf = buf;
+    cap->len = len;
+    cap->channel = channel;
+    cap->reset_mode = ((timx->SMCR & TIM_SMCR_SMS_MSK) == TIM_SMCR_SMS_RESET);
+
+    rcc_enable_dma(req->dma);
+    dma_stream_start(req,
+                     DMA_SxCR_DIR_P2M | DMA_SxCR_PSIZE_32 | DMA_SxCR_MSIZE_32 |
+                     DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_PL_HIGH,
+                     &timx->CCR1 + (channel - 1), buf, len);
+
+    (void)tim_ic_read(timx, channel);                     // drop a capture latched before the stream
+    BITBAND_PERIPH(&timx->DIER, TIM_DIER_CC1DE_POS + channel - 1) = 1;
+    return 0;
+}
+
+/**
+ * @brief Stop a capture log.
+ *
+ * @param cap Stream object.
+ */
+void tim_ic_dma_stop(tim_ic_dma_t *cap) {
+    BITBAND_PERIPH(&cap->timx->DIER, TIM_DIER_CC1DE_POS + cap->channel - 1) = 0;
+    dma_stream_disable(cap->req);
+}
+
+/**
+ * @brief Count the samples logged so far.
+ *
+ * Before the first wrap this is the write position; afterwards the stream's
+ * transfer-complete flag (set even with TCIE off) shows the buffer is full.
+ *
+ * @param cap Stream object.
+ * @return uint16_t Valid samples, at most `len`.
+ */
+uint16_t tim_ic_dma_count(const tim_ic_dma_t *cap) {
+    if (dma_stream_flags(cap->req) & DMA_FLAG_TCIF) return cap->len;
+    return (uint16_t)(cap->len - dma_stream_get(cap->req)->NDTR);
+}
+
+/**
+ * @brief Index of the most recently written sample.
+ *
+ * @param cap Stream object.
+ * @return uint16_t Buffer index.
+ */
+static uint16_t tim_ic_dma_newest(const tim_ic_dma_t *cap) {
+    uint16_t pos = (uint16_t)(cap->len - dma_stream_get(cap->req)->NDTR);   // next slot to be written
+
+    return (pos == 0) ? (uint16_t)(cap->len - 1) : (uint16_t)(pos - 1);
+}
+
+/**
+ * @brief Sum of the last `n` intervals of a capture log.
+ *
+ * Timestamp logs are differenced modulo the counter range (ARR is 2^k - 1
+ * after `tim_ic_init()`); reset-mode logs already hold intervals. The newest
+ * sample is read once from NDTR, so DMA writes during the walk only touch
+ * older-than-needed slots as long as `n` is well below `len`.
+ *
+ * @param cap Stream object.
+ * @param n Intervals to sum.
+ * @return uint64_t Sum in timer ticks.
+ */
+static uint64_t tim_ic_dma_sum(const tim_ic_dma_t *cap, uint16_t n) {
+    uint16_t i = tim_ic_dma_newest(cap);
+    uint32_t mask = cap->timx->ARR;
+    uint64_t sum = 0;
+
+    for (uint16_t k = 0; k < n; k++) {
+        uint16_t prev = (i == 0) ? (uint16_t)(cap->len - 1) : (uint16_t)(i - 1);
+
+        sum += cap->reset_mode ? cap->buf[i] : ((cap->buf[i] - cap->buf[prev]) & mask);
+        i = prev;
+    }
+    return sum;
+}
+
+/**
+ * @brief Derive period, width, frequency and duty from capture logs.
+ *
+ * At least `n + 1` samples are required, which also skips the first sample
+ * of a PWM-input log (captured before the first counter reset).
+ *
+ * @param period Period stream.
+ * @param width Width stream, or 0.
+ * @param n Intervals to average.
+ * @param out Result.
+ * @return int 0 on success, -1 if not enough data.
+ */
+int tim_ic_measure(const tim_ic_dma_t *period, const tim_ic_dma_t *width,
+                   uint16_t n, tim_ic_measure_t *out) {
+    uint64_t psum, wsum = 0;
+
+    if (n == 0 || n >= period->len || tim_ic_dma_count(period) <= n) return -1;
+    if (width && (n >= width->len || tim_ic_dma_count(width) <= n)) return -1;
+
+    psum = tim_ic_dma_sum(period, n);
+    if (psum == 0) return -1;
+    if (width) wsum = tim_ic_dma_sum(width, n);
+
+    out->period = (uint32_t)(psum / n);
+    out->width = (uint32_t)(wsum / n);
+    out->freq_hz = (uint32_t)(((uint64_t)tim_tick_hz(period->timx) * n + psum / 2) / psum);
+    out->duty_permille = (uint16_t)((wsum * 1000U + psum / 2) / psum);
+    return 0;
+}
+
+/**
+ * @brief DMA stream callback for burst playback.
+ *
+ * Circular: HT frees half 0, TC frees half 1. Double buffer: after TC the
+ * stream has switched to the other target, so the buffer not named by CT is
+ * free. One-shot: TC ends playback.
+ *
+ * @param flags Stream flags that were pending.
+ * @param ctx Burst state of the timer.
+ */
+static void tim_burst_dma_irq(uint32_t flags, void *ctx) {
+    tim_burst_state_t *st = (tim_burst_state_t *)ctx;
+    const dma_request_t *req = &periph_lookup(st->timx)->dma_tx;
+
+    if (st->mode == TIM_BURST_CIRCULAR) {
+        if ((flags & DMA_FLAG_HTIF) && st->cb) st->cb(st->timx, 0, st->ctx);
+        if ((flags & DMA_FLAG_TCIF) && st->cb) st->cb(st->timx, 1, st->ctx);
+    } else if (flags & DMA_FLAG_TCIF) {
+        if (st->mode == TIM_BURST_DOUBLE) {
+            uint8_t free_buf = (dma_stream_get(req)->CR & DMA_SxCR_CT) ? 0 : 1;
+            if (st->cb) st->cb(st->timx, free_buf, st->ctx);
+        } else {
+            BITBAND_PERIPH(&st->timx->DIER, TIM_DIER_UDE_POS) = 0;
+            if (st->cb) st->cb(st->timx, 0, st->ctx);
+        }
+    }
+}
+
+/**
+ * @brief Start DMA burst playback of compare values on update events.
+ *
+ * DCR points the DMAR window at CCR`first_ch` with a burst of `nch`
+ * registers; the UP stream writes DMAR once per value and the timer spreads
+ * each burst over the consecutive registers.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param first_ch First channel per burst.
+ * @param nch Channels per burst.
+ * @param buf0 Frames.
+ * @param buf1 Second buffer (double mode).
+ * @param frames Frames per buffer.
+ * @param mode Playback mode.
+ * @param cb Callback, or 0.
+ * @param ctx User pointer.
+ * @return int 0 if started, -1 if unsupported.
+ */
+int tim_burst_start(TIM_TypeDef *timx, uint8_t first_ch, uint8_t nch,
+                    const uint16_t *buf0, const uint16_t *buf1, uint16_t frames,
+                    tim_burst_mode_t mode, tim_burst_callback_t cb, void *ctx) {
+    int idx = tim_index(timx);
+    const dma_request_t *req;
+    tim_burst_state_t *st;
+    uint32_t count = (uint32_t)frames * nch;
+    uint32_t cr = DMA_SxCR_DIR_M2P | DMA_SxCR_PSIZE_16 | DMA_SxCR_MSIZE_16 |
+                  DMA_SxCR_MINC | DMA_SxCR_PL_HIGH | DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS || first_ch < 1 || nch < 1 || first_ch + nch > 5) return -1;
+    if (count == 0 || count > 0xFFFFU || (mode == TIM_BURST_DOUBLE && !buf1)) return -1;
+
+    req = &periph_lookup(timx)->dma_tx;
+    st = &tim_burst[idx];
+
+    BITBAND_PERIPH(&timx->DIER, TIM_DIER_UDE_POS) = 0;   // UDE off while reprogramming
+    st->timx = timx;
+    st->cb = cb;
+    st->ctx = ctx;
+    st->mode = mode;
+
+    timx->DCR = ((uint32_t)(nch - 1U) << TIM_DCR_DBL_POS) |
+                ((uint32_t)((&timx->CCR1 - &timx->CR1) + (first_ch - 1U)) << TIM_DCR_DBA_POS);
+
+    if (mode == TIM_BURST_CIRCULAR) cr |= DMA_SxCR_CIRC | DMA_SxCR_HTIE;
+    if (mode == TIM_BURST_DOUBLE)   cr |= DMA_SxCR_CIRC | DMA_SxCR_DBM;
+
+    rcc_enable_dma(req->dma);
+    dma_stream_attach(req, tim_burst_dma_irq, st);
+    dma_stream_disable(req);
+    dma_stream_get(req)->M1AR = (uint32_t)(uintptr_t)buf1;   // only used with DBM
+    dma_stream_start(req, cr, &timx->DMAR, buf0, (uint16_t)count);
+
+    BITBAND_PERIPH(&timx->DIER, TIM_DIER_UDE_POS) = 1;
+    return 0;
+}
+
+/**
+ * @brief Stop burst playback.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ */
+void tim_burst_stop(TIM_TypeDef *timx) {
+    int idx = tim_index(timx);
+    const dma_request_t *req;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS) return;
+    req = &periph_lookup(timx)->dma_tx;
+    BITBAND_PERIPH(&timx->DIER, TIM_DIER_UDE_POS) = 0;
+    dma_stream_disable(req);
+    dma_stream_attach(req, 0, 0);
+}
+
+/**
+ * @brief Accounts one 16-bit counter wrap and clears UIF.
+ *
+ * The direction is taken from where the counter landed rather than from
+ * DIR, which may already have changed: just past an overflow CNT is near 0,
+ * just past an underflow it is near 0xFFFF.
+ *
+ * @param st Encoder state.
+ * @param timx Encoder timer.
+ */
+static void tim_encoder_wrap(tim_encoder_state_t *st, TIM_TypeDef *timx) {
+    timx->SR = ~TIM_SR_UIF;                                  // rc_w0: clear UIF only
+    if (timx->CNT < 0x8000U) st->high += 0x10000;
+    else                     st->high -= 0x10000;
+}
+
+/**
+ * @brief Configure quadrature encoder mode.
+ *
+ * Both channels capture their own pin (CCxS = 01) through the filter; the
+ * slave mode controller counts up or down from the phase relation. URS
+ * keeps the UG event below from raising an update interrupt.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param cfg Encoder settings.
+ * @return int 0 on success, -1 on unsupported timer.
+ */
+int tim_encoder_init(TIM_TypeDef *timx, const tim_encoder_config_t *cfg) {
+    int idx = tim_index(timx);
+    tim_encoder_state_t *st;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS) return -1;
+    st = &tim_encoder[idx];
+
+    rcc_enable_tim(timx);
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_CEN_POS) = 0;   // CEN off while reconfiguring
+
+    tim_ic_setup(timx, 1, TIM_CCMR_CCS_DIRECT, cfg->invert ? TIM_IC_FALLING : TIM_IC_RISING, 0, cfg->filter);
+    tim_ic_setup(timx, 2, TIM_CCMR_CCS_DIRECT, TIM_IC_RISING, 0, cfg->filter);
+    timx->SMCR = (timx->SMCR & ~TIM_SMCR_SMS_MSK) | (uint32_t)cfg->mode;
+
+    timx->PSC = 0;
+    timx->ARR = 0xFFFFFFFFUL;                                // 0xFFFF on 16-bit timers
+    timx->CR1 |= TIM_CR1_URS;
+    timx->EGR = TIM_EGR_UG;
+    timx->CNT = 0;
+    timx->SR = ~TIM_SR_UIF;
+
+    st->high = 0;
+    st->last_us = 0;
+    st->active = 1;
+
+    if (!tim_is_32bit(timx)) {
+        BITBAND_PERIPH(&timx->DIER, TIM_DIER_UIE_POS) = 1;
+        nvic_enable_irq((IRQn_Type)periph_lookup(timx)->irqn);
+    }
+
+    BITBAND_PERIPH(&timx->CR1, TIM_CR1_CEN_POS) = 1;
+    return 0;
+}
+
+/**
+ * @brief Read the extended encoder position.
+ *
+ * CNT is read first; if UIF is then found set, a wrap happened that the
+ * interrupt has not counted yet (it may be masked or lower priority), so it
+ * is accounted here and CNT re-read.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @return int32_t Position in counts.
+ */
+int32_t tim_encoder_position(TIM_TypeDef *timx) {
+    int idx = tim_index(timx);
+    tim_encoder_state_t *st;
+    uint32_t primask, cnt;
+    int32_t pos;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS) return 0;
+    if (tim_is_32bit(timx)) return (int32_t)timx->CNT;
+    st = &tim_encoder[idx];
+
+    primask = irq_save();
+    cnt = timx->CNT;
+    if (timx->SR & TIM_SR_UIF) {
+        tim_encoder_wrap(st, timx);
+        cnt = timx->CNT;
+    }
+    pos = st->high + (int32_t)cnt;
+    irq_restore(primask);
+
+    return pos;
+}
+
+/**
+ * @brief Set the extended encoder position.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param pos New position.
+ */
+void tim_encoder_set_position(TIM_TypeDef *timx, int32_t pos) {
+    int idx = tim_index(timx);
+    uint32_t primask;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS) return;
+
+    primask = irq_save();
+    if (tim_is_32bit(timx)) {
+        timx->CNT = (uint32_t)pos;
+    } else {
+        timx->CNT = (uint32_t)pos & 0xFFFFU;
+        timx->SR = ~TIM_SR_UIF;
+        tim_encoder[idx].high = (int32_t)((uint32_t)pos & 0xFFFF0000U);
+    }
+    tim_encoder[idx].last_pos = pos;
+    irq_restore(primask);
+}
+
+/**
+ * @brief Estimate encoder velocity since the previous call.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @return int32_t Counts per second.
+ */
+int32_t tim_encoder_velocity(TIM_TypeDef *timx) {
+    int idx = tim_index(timx);
+    tim_encoder_state_t *st;
+    int32_t pos, delta;
+    uint64_t now, dt;
+
+    if (idx < 0 || idx >= TIM_CC_ROWS) return 0;
+    st = &tim_encoder[idx];
+
+    pos = tim_encoder_position(timx);
+    now = hal_micros();
+    delta = pos - st->last_pos;
+    dt = now - st->last_us;
+
+    st->last_pos = pos;
+    if (st->last_us == 0 || dt == 0) {
+        st->last_us = now ? now : 1;
+        return 0;
+    }
+    st->last_us = now;
+
+    return (int32_t)(((int64_t)delta * 1000000) / (int64_t)dt);
+}
+
+/**
+ * @brief Update interrupt service shared by the timer vectors.
+ *
+ * @param idx Row of the timer in the per-timer tables.
+ */
+static void tim_update_irq(int idx) {
+    TIM_TypeDef *timx = tim_ports[idx];
+    tim_update_slot_t *slot = &tim_update[idx];
+
+    if (!(timx->SR & TIM_SR_UIF) || !(timx->DIER & TIM_DIER_UIE)) return;
+
+    if (idx < TIM_CC_ROWS && tim_encoder[idx].active) tim_encoder_wrap(&tim_encoder[idx], timx);
+    else                                              timx->SR = ~TIM_SR_UIF;
+
+    if (slot->cb) slot->cb(timx, slot->ctx);
+}
+
+/**
+ * @brief Routes a timer's update interrupt to a callback.
+ *
+ * @param timx Pointer to the TIMx peripheral.
+ * @param cb Callback, or 0 to detach.
+ * @param ctx User pointer.
+ * @param priority NVIC priority 0–15.
+ * @return int 0 on success, -1 on unsupported timer.
+ */
+int tim_set_update_callback(TIM_TypeDef *timx, tim_callback_t cb, void *ctx, uint8_t priority) {
+    int idx = tim_index(timx);
+    IRQn_Type irqn;
+
+    if (idx < 0) return -1;
+    irqn = (IRQn_Type)periph_lookup(timx)->irqn;
+
+    BITBAND_PERIPH(&timx->DIER, TIM_DIER_UIE_POS) = 0;   // UIE off while swapping
+    tim_update[idx].cb = cb;
+    tim_update[idx].ctx = ctx;
+
+    if (cb) {
+        timx->SR = ~TIM_SR_UIF;
+        nvic_set_priority(irqn, priority);
+        nvic_enable_irq(irqn);
+        BITBAND_PERIPH(&timx->DIER, TIM_DIER_UIE_POS) = 1;
+    } else if (idx < TIM_CC_ROWS && tim_encoder[idx].active && !tim_is_32bit(timx)) {
+        BITBAND_PERIPH(&timx->DIER, TIM_DIER_UIE_POS) = 1;   // encoder still needs wraps
+    }
+    return 0;
+}
+
+void TIM1_UP_TIM10_IRQHandler(void) { tim_update_irq(0); }
+void TIM2_IRQHandler(void)          { tim_update_irq(1); }
+void TIM3_IRQHandler(void)          { tim_update_irq(2); }
+void TIM4_IRQHandler(void)          { tim_update_irq(3); }
+void TIM5_IRQHandler(void)          { tim_update_irq(4); }
+void TIM8_UP_TIM13_IRQHandler(void) { tim_update_irq(5); }
+void TIM6_DAC_IRQHandler(void)      { tim_update_irq(6); }
+void TIM7_IRQHandler(void)          { tim_update_irq(7); }
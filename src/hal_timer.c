@@ -0,0 +1,232 @@
+/**
+ * @file hal_timer.c
+ * @brief Hierarchical timing wheel implementation for STM32F446RE.
+ *
+ * Four levels of 64 slots cover 2^24 ticks (about 4.6 hours at 1 ms); longer
+ * timeouts park in the last level and are re-filed when it cascades. Level 0
+ * holds timers due within 64 ticks, one slot per tick. Each time level 0 wraps,
+ * one slot of level 1 is re-filed into the lower levels (and so on upward), so
+ * a timer is moved at most three times over its life.
+ *
+ * Slots are singly linked lists with a back-link (`pprev`), so a timer is
+ * unlinked in O(1) wherever it is. All list changes happen with interrupts
+ * masked; callbacks run unmasked.
+ */
+
+#include <stdint.h>
+#include "hal_timer.h"
+#include "hal_systick.h"
+#include "hal_nvic.h"
+
+#define TIMER_LEVELS     4U
+#define TIMER_SLOT_BITS  6U
+#define TIMER_SLOTS      (1U << TIMER_SLOT_BITS)
+#define TIMER_SLOT_MASK  (TIMER_SLOTS - 1U)
+#define TIMER_MAX_DELTA  ((1UL << (TIMER_LEVELS * TIMER_SLOT_BITS)) - 1U)
+
+/// Wheel slots, `timer_wheel[level][slot]`.
+static hal_timer_t *timer_wheel[TIMER_LEVELS][TIMER_SLOTS];
+
+/// Timers detached from the current level-0 slot, waiting for their callback.
+static hal_timer_t *timer_expired;
+
+/// Next tick the wheel will process.
+static uint32_t timer_now;
+
+/// Set once `timer_now` has been synchronized with the system tick.
+static uint8_t timer_started;
+
+/**
+ * @brief Synchronizes the wheel with the system tick on first use.
+ */
+static void timer_sync(void) {
+    if (timer_started) return;
+    timer_now = (uint32_t)hal_ticks();
+    timer_started = 1;
+}
+
+/**
+ * @brief Pushes a timer at the head of a list.
+ *
+ * @param head List head.
+ * @param t Timer.
+ */
+static void timer_link(hal_timer_t **head, hal_timer_t *t) {
+    t->next = *head;
+    if (t->next) t->next->pprev = &t->next;
+    *head = t;
+    t->pprev = head;
+}
+
+/**
+ * @brief Removes a timer from whatever list holds it.
+ *
+ * @param t Timer (must be linked).
+ */
+static void timer_unlink(hal_timer_t *t) {
+    *t->pprev = t->next;
+    if (t->next) t->next->pprev = t->pprev;
+    t->next = 0;
+    t->pprev = 0;
+}
+
+/**
+ * @brief Files a timer into the wheel slot matching its distance from `timer_now`.
+ *
+ * Timers already due go into the slot processed next.
+ *
+ * @param t Timer with `expires` set.
+ */
+static void timer_insert(hal_timer_t *t) {
+    uint32_t expires = t->expires;
+    int32_t delta = (int32_t)(expires - timer_now);
+    uint32_t level = 0;
+
+    if (delta < 0) {
+        expires = timer_now;
+    } else if ((uint32_t)delta > TIMER_MAX_DELTA) {
+        expires = timer_now + TIMER_MAX_DELTA;        // park; re-filed on cascade
+        level = TIMER_LEVELS - 1U;
+    } else {
+        while (level < TIMER_LEVELS - 1U && (uint32_t)delta >= (1UL << ((level + 1U) * TIMER_SLOT_BITS))) {
+            level++;
+        }
+    }
+
+    timer_link(&timer_wheel[level][(expires >> (level * TIMER_SLOT_BITS)) & TIMER_SLOT_MASK], t);
+}
+
+/**
+ * @brief Re-files every timer of one slot into the levels below.
+ *
+ * @param level Level being cascaded (1 and up).
+ * @return uint32_t Slot index that was cascaded (0 means the next level is due too).
+ */
+static uint32_t timer_cascade(uint32_t level) {
+    uint32_t idx = (timer_now >> (level * TIMER_SLOT_BITS)) & TIMER_SLOT_MASK;
+    hal_timer_t *t = timer_wheel[level][idx];
+
+    timer_wheel[level][idx] = 0;
+    while (t) {
+        hal_timer_t *next = t->next;
+        timer_insert(t);
+        t = next;
+    }
+
+    return idx;
+}
+
+/**
+ * @brief Stores callback and context and marks the timer idle.
+ *
+ * @param t Timer.
+ * @param cb Callback.
+ * @param ctx User pointer.
+ */
+void hal_timer_init(hal_timer_t *t, hal_timer_cb_t cb, void *ctx) {
+    t->next = 0;
+    t->pprev = 0;
+    t->expires = 0;
+    t->period = 0;
+    t->cb = cb;
+    t->ctx = ctx;
+}
+
+/**
+ * @brief Computes the expiry from the current tick and files the timer.
+ *
+ * @param t Timer.
+ * @param delay_ms First expiry.
+ * @param period_ms Reload interval, 0 for one-shot.
+ */
+void hal_timer_start(hal_timer_t *t, uint32_t delay_ms, uint32_t period_ms) {
+    uint32_t primask = irq_save();
+
+    timer_sync();
+    if (t->pprev) timer_unlink(t);
+
+    t->expires = (uint32_t)hal_ticks() + delay_ms;
+    t->period = period_ms;
+    timer_insert(t);
+
+    irq_restore(primask);
+}
+
+/**
+ * @brief Unlinks the timer from its slot or from the expired list.
+ *
+ * @param t Timer.
+ */
+void hal_timer_stop(hal_timer_t *t) {
+    uint32_t primask = irq_save();
+    if (t->pprev) timer_unlink(t);
+    irq_restore(primask);
+}
+
+/**
+ * @brief Reports whether the timer is linked anywhere.
+ *
+ * @param t Timer.
+ * @return int 1 if armed.
+ */
+int hal_timer_is_active(const hal_timer_t *t) {
+    return t->pprev ? 1 : 0;
+}
+
+/**
+ * @brief Processes every tick up to now, running callbacks after each one.
+ *
+ * Per tick: cascade if level 0 wrapped, move the level-0 slot to the expired
+ * list, advance `timer_now`, then pop expired timers one at a time. Periodic
+ * timers are re-filed before their callback so the callback may stop them.
+ *
+ * @return uint32_t Number of callbacks run.
+ */
+uint32_t hal_timer_process(void) {
+    uint32_t ran = 0;
+    uint32_t primask = irq_save();
+
+    timer_sync();
+    uint32_t now = (uint32_t)hal_ticks();
+
+    while ((int32_t)(now - timer_now) >= 0) {
+        irq_restore(primask);                          // let interrupts in between ticks
+        primask = irq_save();
+
+        uint32_t idx = timer_now & TIMER_SLOT_MASK;
+
+        if (idx == 0) {
+            for (uint32_t level = 1; level < TIMER_LEVELS; level++) {
+                if (timer_cascade(level) != 0) break;
+            }
+        }
+
+        hal_timer_t *slot = timer_wheel[0][idx];
+        timer_wheel[0][idx] = 0;
+        timer_now++;
+
+        if (slot == 0) continue;
+
+        // Move the slot to the expired list (it is empty between ticks)
+        timer_expired = slot;
+        slot->pprev = &timer_expired;
+
+        while (timer_expired) {
+            hal_timer_t *t = timer_expired;
+            timer_unlink(t);
+
+            if (t->period) {
+                t->expires += t->period;
+                timer_insert(t);
+            }
+
+            irq_restore(primask);
+            if (t->cb) t->cb(t->ctx);
+            ran++;
+            primask = irq_save();
+        }
+    }
+
+    irq_restore(primask);
+    return ran;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file hal_timestamp.c
+ * @brief 64-bit cascaded TIM2/TIM5 timestamp counter implementation.
+ *
+ * TIM2 (master) runs free with ARR = 0xFFFFFFFF and MMS = update, TIM5
+ * (slave) uses external clock mode 1 with TS = ITR0, which is TIM2's TRGO.
+ * Direct register access only.
+ */
+
+#include <stdint.h>
+#include "hal_timestamp.h"
+#include "hal_tim.h"
+#include "hal_rcc.h"
+#include "hal_bitband.h"
+
+/**
+ * @brief Low-word values treated as "just wrapped" by hal_ts_now().
+ *
+ * TIM5 increments a few timer clocks after TIM2 wraps (trigger
+ * resynchronization), so a low word this small may belong to a high word
+ * that has not been updated yet.
+ */
+#define HAL_TS_WRAP_GUARD 32U
+
+/// Counter rate recorded by hal_ts_init().
+static uint32_t hal_ts_rate_hz;
+
+/**
+ * @brief Sets up and starts the TIM2 → TIM5 chain.
+ *
+ * The slave is started first so it is ready for the master's first wrap.
+ */
+void hal_ts_init(void) {
+    rcc_enable_tim(TIM2);
+    rcc_enable_tim(TIM5);
+
+    BITBAND_PERIPH(&TIM2->CR1, TIM_CR1_CEN_POS) = 0;
+    BITBAND_PERIPH(&TIM5->CR1, TIM_CR1_CEN_POS) = 0;
+
+    TIM5->PSC = 0;
+    TIM5->ARR = 0xFFFFFFFFUL;
+    TIM5->SMCR = TIM_SMCR_TS_ITR0 | TIM_SMCR_SMS_EXT1;       // count TIM2 TRGO
+    TIM5->EGR = TIM_EGR_UG;
+    TIM5->CNT = 0;
+
+    TIM2->PSC = 0;
+    TIM2->ARR = 0xFFFFFFFFUL;
+    TIM2->SMCR = 0;
+    TIM2->CR2 = (TIM2->CR2 & ~TIM_CR2_MMS_MSK) | TIM_CR2_MMS_UPDATE;
+    TIM2->CR1 |= TIM_CR1_URS;                                // UG below is not an overflow
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->CNT = 0;
+    TIM5->CNT = 0;                                           // drop a count from the UG above
+
+    hal_ts_rate_hz = rcc_get_apb1_timclk_hz();
+
+    BITBAND_PERIPH(&TIM5->CR1, TIM_CR1_CEN_POS) = 1;
+    BITBAND_PERIPH(&TIM2->CR1, TIM_CR1_CEN_POS) = 1;
+}
+
+/**
+ * @brief Reads the 64-bit counter.
+ *
+ * Reads high, low, high; a changed high word means a wrap happened in
+ * between and the read is repeated. A low word inside the wrap guard is
+ * also re-read, since the high word may still be catching up.
+ *
+ * @return uint64_t Counter value.
+ */
+uint64_t hal_ts_now(void) {
+    uint32_t hi, lo;
+
+    for (;;) {
+        hi = TIM5->CNT;
+        lo = TIM2->CNT;
+        if (lo < HAL_TS_WRAP_GUARD) continue;
+        if (TIM5->CNT == hi) break;
+    }
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/**
+ * @brief Returns the counter rate.
+ *
+ * @return uint32_t Hz.
+ */
+uint32_t hal_ts_hz(void) {
+    return hal_ts_rate_hz;
+}
+
+/**
+ * @brief Scales ticks to a unit of 1/scale seconds.
+ *
+ * Whole seconds and the remainder are scaled separately, so nothing
+ * overflows for any 64-bit tick count.
+ *
+ * @param ticks Ticks.
+ * @param scale Units per second (1e9 for ns, 1e6 for us).
+ * @return uint64_t Converted value.
+ */
+static uint64_t hal_ts_scale(uint64_t ticks, uint32_t scale) {
+    uint32_t hz = hal_ts_rate_hz ? hal_ts_rate_hz : 1U;
+
+    return (ticks / hz) * scale + ((ticks % hz) * scale) / hz;
+}
+
+/**
+ * @brief Ticks to nanoseconds.
+ *
+ * @param ticks Ticks.
+ * @return uint64_t Nanoseconds.
+ */
+uint64_t hal_ts_to_ns(uint64_t ticks) {
+    return hal_ts_scale(ticks, 1000000000U);
+}
+
+/**
+ * @brief Ticks to microseconds.
+ *
+ * @param ticks Ticks.
+ * @return uint64_t Microseconds.
+ */
+uint64_t hal_ts_to_us(uint64_t ticks) {
+    return hal_ts_scale(ticks, 1000000U);
+}
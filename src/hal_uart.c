@@ -2,13 +2,82 @@
  * @file hal_uart.c
  * @brief UART initialization and communication functions for STM32F411RE.
  *
- * Implements basic UART send/receive routines using polling.
+ * Implements UART send/receive routines. Transmission goes through a per-port
+ * ring buffer drained by DMA (USART TX request), so writers only pay for the
+ * copy into the ring. Reception is interrupt-driven: the USART IRQ pushes
+ * bytes into a per-port single-producer/single-consumer ring, and an optional
+ * callback is fired when the line goes idle at the end of a burst.
  * Includes baud rate configuration and a simple `printf`-style string writer.
- * This setup assumes no interrupt or DMA use — purely blocking mode.
  */
 
 #include <stdint.h>
+#include <stddef.h>
 #include "hal_uart.h"
+#include "hal_dma.h"
+#include "hal_rcc.h"
+#include "hal_nvic.h"
+#include "hal_ramfunc.h"
+
+#if (UART_TX_BUF_SIZE & (UART_TX_BUF_SIZE - 1U)) != 0
+#error "UART_TX_BUF_SIZE must be a power of two"
+#endif
+#if (UART_RX_BUF_SIZE & (UART_RX_BUF_SIZE - 1U)) != 0
+#error "UART_RX_BUF_SIZE must be a power of two"
+#endif
+
+#define UART_PORT_COUNT  6U
+#define UART_TX_MASK     (UART_TX_BUF_SIZE - 1U)
+#define UART_RX_MASK     (UART_RX_BUF_SIZE - 1U)
+
+/**
+ * @brief Transmit ring buffer state for one USART.
+ *
+ * `head` and `tail` are free-running counters (masked on access), so
+ * `head - tail` is always the number of queued bytes. Bytes between
+ * `tail` and `tail + inflight` are currently owned by the DMA stream.
+ */
+typedef struct {
+    uint8_t buf[UART_TX_BUF_SIZE];  /**< Queued bytes */
+    volatile uint16_t head;         /**< Next write position (producer) */
+    volatile uint16_t tail;         /**< First byte not yet fully sent */
+    volatile uint16_t inflight;     /**< Bytes handed to DMA, starting at tail */
+} uart_tx_ring_t;
+
+/**
+ * @brief Receive ring buffer state for one USART.
+ *
+ * Lock-free: only the ISR writes `head`, only the reader writes `tail`.
+ * Both are free-running counters masked on access.
+ */
+typedef struct {
+    uint8_t buf[UART_RX_BUF_SIZE];  /**< Received bytes */
+    volatile uint16_t head;         /**< Next write position (ISR) */
+    volatile uint16_t tail;         /**< Next read position (reader) */
+    uart_idle_cb_t idle_cb;         /**< Idle-line callback, or 0 */
+} uart_rx_ring_t;
+
+static uart_tx_ring_t uart_tx_ring[UART_PORT_COUNT];
+static uart_rx_ring_t uart_rx_ring[UART_PORT_COUNT];
+
+/**
+ * @brief Base address of each port, indexed like `uart_index()`.
+ */
+static UART_TypeDef *const uart_ports[UART_PORT_COUNT] = {
+    USART1, USART2, USART3, UART4, UART5, USART6
+};
+
+/**
+ * @brief Maps a UART base address to its index in the driver tables.
+ *
+ * The interrupt line and TX DMA request come from the same descriptor
+ * (`periph_lookup()`).
+ *
+ * @param uart Pointer to UART peripheral.
+ * @return int 0–5 for USART1, USART2, USART3, UART4, UART5, USART6; -1 if unknown.
+ */
+static int uart_index(UART_TypeDef *uart) {
+    return periph_index(uart, PERIPH_KIND_UART);
+}
 
 /**
  * @brief Configures the UART baud rate register (BRR).
@@ -26,49 +95,256 @@ static void configure_baud(UART_TypeDef *uart, uint32_t periph_clk, baud_rate_t
     uart->BRR = ((periph_clk + (rate / 2U)) / rate);
 }
 
+/**
+ * @brief Retires the finished DMA chunk and starts the next one.
+ *
+ * If the stream is still running, nothing happens. Otherwise the bytes it
+ * sent are released from the ring, and the next contiguous run of queued
+ * bytes (up to the end of the buffer) is handed to DMA.
+ *
+ * Runs from the DMA transfer-complete interrupt and from thread context;
+ * thread-context callers go through `uart_tx_kick_locked()`.
+ *
+ * @param uart Pointer to UART peripheral.
+ * @param idx  Port index from `uart_index()`.
+ */
+static void uart_tx_kick(UART_TypeDef *uart, int idx) {
+    uart_tx_ring_t *ring = &uart_tx_ring[idx];
+    const dma_request_t *req = &periph_lookup(uart)->dma_tx;
+
+    if (ring->inflight) {
+        if (dma_stream_get(req)->CR & DMA_SxCR_EN) return;   // still sending
+        ring->tail += ring->inflight;
+        ring->inflight = 0;
+    }
+
+    uint16_t pending = (uint16_t)(ring->head - ring->tail);
+    if (pending == 0) return;
+
+    uint16_t start = ring->tail & UART_TX_MASK;
+    uint16_t chunk = UART_TX_BUF_SIZE - start;       // contiguous run to end of buffer
+    if (chunk > pending) chunk = pending;
+
+    ring->inflight = chunk;
+    uart->SR = ~USART_SR_TC;                         // TC is rc_w0; other bits ignore the write
+    dma_stream_start(req,
+                     DMA_SxCR_DIR_M2P | DMA_SxCR_MINC | DMA_SxCR_TCIE |
+                     DMA_SxCR_PSIZE_8 | DMA_SxCR_MSIZE_8 | DMA_SxCR_PL_LOW,
+                     &uart->DR, &ring->buf[start], chunk);
+}
+
+/**
+ * @brief `uart_tx_kick()` with interrupts masked, for thread-context callers.
+ *
+ * @param uart Pointer to UART peripheral.
+ * @param idx  Port index from `uart_index()`.
+ */
+static void uart_tx_kick_locked(UART_TypeDef *uart, int idx) {
+    uint32_t primask = irq_save();
+    uart_tx_kick(uart, idx);
+    irq_restore(primask);
+}
+
+/**
+ * @brief TX stream transfer-complete callback: chain the next queued chunk.
+ *
+ * @param flags DMA flags that were pending.
+ * @param ctx Port index, cast to a pointer.
+ */
+static void uart_tx_dma_done(uint32_t flags, void *ctx) {
+    int idx = (int)(intptr_t)ctx;
+
+    (void)flags;
+    uart_tx_kick(uart_ports[idx], idx);
+}
+
+/**
+ * @brief Shared RX interrupt body for all ports.
+ *
+ * Reading SR then DR clears RXNE, ORE and IDLE, so every path ends with one
+ * DR read. A byte received while the ring is full is dropped. Runs from SRAM
+ * so the per-byte cost doesn't grow with flash wait states.
+ *
+ * @param idx Port index from `uart_index()`.
+ */
+HAL_RAMFUNC static void uart_irq_handler(int idx) {
+    UART_TypeDef *uart = uart_ports[idx];
+    uart_rx_ring_t *ring = &uart_rx_ring[idx];
+    uint32_t sr = uart->SR;
+
+    if (sr & (USART_SR_RXNE | USART_SR_ORE)) {
+        uint8_t byte = (uint8_t)(uart->DR & 0xFF);
+        uint16_t head = ring->head;
+
+        if ((uint16_t)(head - ring->tail) < UART_RX_BUF_SIZE) {
+            ring->buf[head & UART_RX_MASK] = byte;
+            ring->head = head + 1;
+        }
+    } else if (sr & USART_SR_IDLE) {
+        (void)uart->DR;                              // SR read + DR read clears IDLE
+    }
+
+    if ((sr & USART_SR_IDLE) && ring->idle_cb) {
+        ring->idle_cb(uart, (uint16_t)(ring->head - ring->tail));
+    }
+}
+
+void USART1_IRQHandler(void) { uart_irq_handler(0); }
+void USART2_IRQHandler(void) { uart_irq_handler(1); }
+void USART3_IRQHandler(void) { uart_irq_handler(2); }
+void UART4_IRQHandler(void)  { uart_irq_handler(3); }
+void UART5_IRQHandler(void)  { uart_irq_handler(4); }
+void USART6_IRQHandler(void) { uart_irq_handler(5); }
+
 /**
  * @brief Reads a single byte from UART (blocking).
  *
- * Waits until a byte is received (RXNE flag is set), then returns it.
+ * Waits until the receive ring holds a byte, then returns it.
  *
  * @param uart Pointer to UART peripheral.
  * @return uint8_t The received byte.
  */
 uint8_t uart_read(UART_TypeDef *uart) {
-    while (!(uart->SR & USART_SR_RXNE)) {
+    uint8_t byte = 0;
+
+    while (uart_read_buf(uart, &byte, 1) == 0) {
         // wait until data is received
     }
 
-    return (uint8_t)(uart->DR & 0xFF);
+    return byte;
 }
 
 /**
- * @brief Sends a single character over UART (blocking).
+ * @brief Returns the number of bytes waiting in the receive ring.
  *
- * Waits until TXE is set, then writes to the data register.
+ * @param uart Pointer to UART peripheral.
+ * @return size_t Bytes available.
+ */
+size_t uart_read_available(UART_TypeDef *uart) {
+    int idx = uart_index(uart);
+    if (idx < 0) return 0;
+
+    return (uint16_t)(uart_rx_ring[idx].head - uart_rx_ring[idx].tail);
+}
+
+/**
+ * @brief Copies up to `max` bytes out of the receive ring without blocking.
  *
  * @param uart Pointer to UART peripheral.
- * @param data Character to transmit.
+ * @param buf Destination buffer.
+ * @param max Capacity of `buf`.
+ * @return size_t Number of bytes copied.
  */
-static void uart_write(UART_TypeDef *uart, char data) {
-    while (!(uart->SR & USART_SR_TXE)) {
-        // wait until transmit buffer is empty
+size_t uart_read_buf(UART_TypeDef *uart, void *buf, size_t max) {
+    int idx = uart_index(uart);
+    if (idx < 0) return 0;
+
+    uart_rx_ring_t *ring = &uart_rx_ring[idx];
+    uint8_t *dst = (uint8_t *)buf;
+    uint16_t tail = ring->tail;
+    uint16_t count = (uint16_t)(ring->head - tail);
+
+    if (count > max) count = (uint16_t)max;
+
+    for (uint16_t i = 0; i < count; i++) {
+        dst[i] = ring->buf[(uint16_t)(tail + i) & UART_RX_MASK];
     }
+    ring->tail = tail + count;                       // publish only after the copy
+
+    return count;
+}
 
-    uart->DR = data;
+/**
+ * @brief Sets (or clears with 0) the idle-line callback for a port.
+ *
+ * @param uart Pointer to UART peripheral.
+ * @param cb Callback fired from the ISR on IDLE.
+ */
+void uart_set_idle_callback(UART_TypeDef *uart, uart_idle_cb_t cb) {
+    int idx = uart_index(uart);
+    if (idx < 0) return;
+
+    uart_rx_ring[idx].idle_cb = cb;
 }
 
 /**
- * @brief Sends a null-terminated string over UART (blocking).
+ * @brief Copies bytes into the transmit ring and starts DMA if it is idle.
+ *
+ * Spins (while still feeding DMA) only when the ring has no free space.
  *
- * Calls `uart_write()` repeatedly to send each character in the string.
+ * @param uart Pointer to UART peripheral.
+ * @param data Bytes to send.
+ * @param len Number of bytes.
+ */
+void uart_write_buf(UART_TypeDef *uart, const void *data, size_t len) {
+    int idx = uart_index(uart);
+    if (idx < 0) return;
+
+    uart_tx_ring_t *ring = &uart_tx_ring[idx];
+    const uint8_t *src = (const uint8_t *)data;
+
+    while (len) {
+        uint16_t used = (uint16_t)(ring->head - ring->tail);
+        uint16_t space = UART_TX_BUF_SIZE - used;
+
+        if (space == 0) {
+            uart_tx_kick_locked(uart, idx);          // wait for DMA to free space
+            continue;
+        }
+
+        if (space > len) space = (uint16_t)len;
+
+        uint16_t head = ring->head;
+        for (uint16_t i = 0; i < space; i++) {
+            ring->buf[(uint16_t)(head + i) & UART_TX_MASK] = src[i];
+        }
+        ring->head = head + space;
+
+        src += space;
+        len -= space;
+        uart_tx_kick_locked(uart, idx);
+    }
+}
+
+/**
+ * @brief Queues a null-terminated string for transmission.
  *
  * @param uart Pointer to UART peripheral.
  * @param msg Null-terminated string to send.
  */
 void uart_print(UART_TypeDef *uart, const char *msg) {
-    while (*msg) {
-        uart_write(uart, *msg++);
+    size_t len = 0;
+    while (msg[len]) len++;
+
+    uart_write_buf(uart, msg, len);
+}
+
+/**
+ * @brief Returns the number of bytes still queued (also feeds DMA if it is idle).
+ *
+ * @param uart Pointer to UART peripheral.
+ * @return size_t Bytes not yet fully sent by DMA.
+ */
+size_t uart_tx_pending(UART_TypeDef *uart) {
+    int idx = uart_index(uart);
+    if (idx < 0) return 0;
+
+    uart_tx_kick_locked(uart, idx);
+    return (uint16_t)(uart_tx_ring[idx].head - uart_tx_ring[idx].tail);
+}
+
+/**
+ * @brief Waits until the ring is empty and the last frame has been shifted out.
+ *
+ * @param uart Pointer to UART peripheral.
+ */
+void uart_flush(UART_TypeDef *uart) {
+    while (uart_tx_pending(uart)) {
+        // DMA is draining the ring
+    }
+
+    while (!(uart->SR & USART_SR_TC)) {
+        // wait for the final stop bit
     }
 }
 
@@ -76,24 +352,50 @@ void uart_print(UART_TypeDef *uart, const char *msg) {
  * @brief Initializes UART peripheral for standard 8N1 config.
  *
  * Sets baud rate, disables parity, selects 1 stop bit and 8 data bits,
- * and enables both transmit and receive logic.
+ * and enables both transmit and receive logic. Transmission is routed
+ * through the DMA stream mapped to this port's TX request; reception is
+ * handled by the RXNE/IDLE interrupt into the receive ring.
+ *
+ * BRR is derived from PCLK1 or PCLK2 (whichever bus the port sits on), read
+ * back from the RCC, so it follows any clock tree set by `rcc_clock_config()`.
  *
  * @param uart Pointer to UART peripheral to initialize.
- * @param periph_clk Peripheral clock frequency in Hz.
  * @param baud Desired baud rate.
  *
  * @note You must enable the RCC clock for the UART externally before calling this.
  */
-void uart_init(UART_TypeDef *uart, uint32_t periph_clk, baud_rate_t baud) {
+void uart_init(UART_TypeDef *uart, baud_rate_t baud) {
+    int idx = uart_index(uart);
+
     // Disable UART before configuration
     uart->CR1 &= ~USART_CR1_UE;
 
-    configure_baud(uart, periph_clk, baud);
+    configure_baud(uart, rcc_get_pclk(uart), baud);
 
     uart->CR1 &= ~(1 << 12);  /**< 8 data bits */
     uart->CR2 &= ~(3 << 12);  /**< 1 stop bit */
     uart->CR1 &= ~(1 << 10);  /**< No parity */
 
+    if (idx >= 0) {
+        const periph_desc_t *desc = periph_lookup(uart);
+        const dma_request_t *req = &desc->dma_tx;
+
+        rcc_enable_dma(req->dma);
+        dma_stream_disable(req);
+        dma_stream_attach(req, uart_tx_dma_done, (void *)(intptr_t)idx);
+
+        uart_tx_ring[idx].head = 0;
+        uart_tx_ring[idx].tail = 0;
+        uart_tx_ring[idx].inflight = 0;
+        uart_rx_ring[idx].head = 0;
+        uart_rx_ring[idx].tail = 0;
+
+        uart->CR3 |= USART_CR3_DMAT;                     /**< TXE requests go to DMA */
+        uart->CR1 |= USART_CR1_RXNEIE | USART_CR1_IDLEIE; /**< RX bytes and idle line raise the IRQ */
+
+        nvic_enable_irq((IRQn_Type)desc->irqn);
+    }
+
     // Enable UART, transmitter, and receiver
     uart->CR1 |= USART_CR1_UE;
     uart->CR1 |= USART_CR1_TE | USART_CR1_RE;